@@ -8,6 +8,7 @@
 //[testing
 //<-
 #include <cassert>
+#include <functional>
 #include <memory>
 #include <map>
 #include <stdexcept>
@@ -35,8 +35,14 @@
 
 #else
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
 #include <type_traits>
+#include <utility>
 
 #ifndef BOOST_DI_AUX_UTILITY_HPP
 #define BOOST_DI_AUX_UTILITY_HPP
@@ -147,6 +153,8 @@ struct no_name {
 
 class config;
 
+template<class> class local_shared_ptr;
+
 template<class...> class injector;
 
 namespace aux { struct none_type; }
@@ -166,6 +174,8 @@ template<
 
 namespace providers { class heap; class stack_over_heap; } // providers
 
+namespace scopes { template<class, std::size_t, std::size_t> class pooled; class reloadable; class injector_singleton; } // scopes
+
 }}} // boost::di::v1
 
 #endif
@@ -250,6 +260,11 @@ struct is_smart_ptr<std::weak_ptr<T>>
     : std::true_type
 { };
 
+template<class T>
+struct is_smart_ptr<local_shared_ptr<T>>
+    : std::true_type
+{ };
+
 template<class T, class... TArgs>
 decltype(void(T{std::declval<TArgs>()...}), std::true_type{})
 test_is_braces_constructible(int);
@@ -353,14 +368,20 @@ using pool_t = pool<aux::type_list<TArgs...>>;
 template<class... TArgs>
 class pool<aux::type_list<TArgs...>> : public TArgs... {
 public:
-    template<class... Ts>
-    explicit pool(const Ts&... args) noexcept
-        : Ts(args)...
+    template<class... Ts, BOOST_DI_REQUIRES(std::is_same<
+        aux::bool_list<aux::never<Ts>::value...>
+      , aux::bool_list<std::is_same<pool, std::decay_t<Ts>>::value...>
+    >::value)>
+    explicit pool(Ts&&... args) noexcept
+        : std::decay_t<Ts>(std::forward<Ts>(args))...
     { }
 
+    /**
+     * Subset of `p`, moved when `p` is an rvalue
+     */
     template<class... Ts, class TPool>
-    pool(const aux::type_list<Ts...>&, const TPool& p) noexcept
-        : pool(static_cast<const Ts&>(p)...)
+    pool(aux::type_list<Ts...>&&, TPool&& p) noexcept
+        : pool(static_cast<std::conditional_t<std::is_lvalue_reference<TPool>::value, const Ts&, Ts&&>>(p)...)
     { }
 };
 
@@ -404,6 +425,180 @@ public:
 
 #endif
 
+#ifndef BOOST_DI_LOCAL_SHARED_PTR_HPP
+#define BOOST_DI_LOCAL_SHARED_PTR_HPP
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace aux {
+
+// counter of local handles, which keep the block it belongs to (`owner`) alive whilst there are any
+struct local_shared_counter {
+    std::size_t count = 1;
+    std::shared_ptr<const void> owner;
+};
+
+// counter and the object in one allocation, next to the atomic counter of `std::shared_ptr`
+template<class T>
+struct local_shared_object : local_shared_counter {
+    template<class... TArgs>
+    explicit local_shared_object(TArgs&&... args)
+        : object(std::forward<TArgs>(args)...)
+    { }
+
+    T object;
+};
+
+// counter of the object owned by a smart pointer already
+template<class TOwner>
+struct local_shared_owner : local_shared_counter {
+    explicit local_shared_owner(TOwner&& object) noexcept
+        : object(std::move(object))
+    { }
+
+    TOwner object;
+};
+
+} // aux
+
+template<class> class local_shared_ptr;
+
+template<class T, class... TArgs>
+local_shared_ptr<T> make_local_shared(TArgs&&...);
+
+// shared handle with non-atomic reference counter, copies of one handle must not be made by different threads at the same time
+template<class T>
+class local_shared_ptr {
+    template<class> friend class local_shared_ptr;
+    template<class T_, class... TArgs> friend local_shared_ptr<T_> make_local_shared(TArgs&&...);
+
+public:
+    using element_type = T;
+
+    constexpr local_shared_ptr() noexcept { }
+
+    constexpr local_shared_ptr(std::nullptr_t) noexcept { } // non explicit
+
+    /**
+     * Shares the ownership, allocates the counter
+     */
+    template<class TOther, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    explicit local_shared_ptr(std::shared_ptr<TOther> object)
+        : local_shared_ptr{adopt(std::move(object))}
+    { }
+
+    /**
+     * Takes over the ownership, allocates the counter
+     */
+    template<class TOther, class TDeleter, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    explicit local_shared_ptr(std::unique_ptr<TOther, TDeleter> object)
+        : local_shared_ptr{adopt(std::move(object))}
+    { }
+
+    local_shared_ptr(const local_shared_ptr& other) noexcept
+        : object_(other.object_), counter_(other.counter_) {
+        acquire();
+    }
+
+    template<class TOther, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    local_shared_ptr(const local_shared_ptr<TOther>& other) noexcept // non explicit
+        : object_(other.object_), counter_(other.counter_) {
+        acquire();
+    }
+
+    local_shared_ptr(local_shared_ptr&& other) noexcept
+        : object_(other.object_), counter_(other.counter_) {
+        other.object_ = nullptr;
+        other.counter_ = nullptr;
+    }
+
+    ~local_shared_ptr() noexcept {
+        release();
+    }
+
+    local_shared_ptr& operator=(local_shared_ptr other) noexcept {
+        std::swap(object_, other.object_);
+        std::swap(counter_, other.counter_);
+        return *this;
+    }
+
+    void reset() noexcept {
+        release();
+        object_ = nullptr;
+        counter_ = nullptr;
+    }
+
+    T* get() const noexcept {
+        return object_;
+    }
+
+    std::add_lvalue_reference_t<T> operator*() const noexcept {
+        return *object_;
+    }
+
+    T* operator->() const noexcept {
+        return object_;
+    }
+
+    explicit operator bool() const noexcept {
+        return object_ != nullptr;
+    }
+
+    std::size_t use_count() const noexcept {
+        return counter_ ? counter_->count : 0;
+    }
+
+    /**
+     * `std::shared_ptr` sharing the ownership (atomic reference counter)
+     */
+    std::shared_ptr<T> to_shared_ptr() const noexcept {
+        return counter_ ? std::shared_ptr<T>{counter_->owner, object_} : nullptr;
+    }
+
+private:
+    template<class TBlock>
+    local_shared_ptr(T* object, std::shared_ptr<TBlock> block) noexcept
+        : object_(object), counter_(block.get()) {
+        counter_->owner = std::move(block);
+    }
+
+    template<class TOwner>
+    static local_shared_ptr adopt(TOwner object) {
+        if (!object) {
+            return {};
+        }
+        T* ptr = object.get();
+        return {ptr, std::make_shared<aux::local_shared_owner<TOwner>>(std::move(object))};
+    }
+
+    void acquire() noexcept {
+        if (counter_) {
+            ++counter_->count;
+        }
+    }
+
+    void release() noexcept {
+        if (counter_ && !--counter_->count) {
+            auto owner = std::move(counter_->owner); // might release the counter
+        }
+    }
+
+    T* object_ = nullptr;
+    aux::local_shared_counter* counter_ = nullptr;
+};
+
+// object, its non-atomic and atomic counters in one allocation
+template<class T, class... TArgs>
+inline local_shared_ptr<T> make_local_shared(TArgs&&... args) {
+    auto block = std::make_shared<aux::local_shared_object<T>>(std::forward<TArgs>(args)...);
+    T* object = &block->object;
+    return {object, std::move(block)};
+}
+
+}}} // boost::di::v1
+
+#endif
+
 #ifndef BOOST_DI_WRAPPERS_UNIQUE_HPP
 #define BOOST_DI_WRAPPERS_UNIQUE_HPP
 
@@ -450,6 +645,11 @@ struct unique<T*> {
         return boost::shared_ptr<I>{object};
     }
 
+    template<class I>
+    inline operator local_shared_ptr<I>() const {
+        return local_shared_ptr<I>{std::unique_ptr<I>{object}};
+    }
+
     template<class I>
     inline operator std::unique_ptr<I>() const noexcept {
         return std::unique_ptr<I>{object};
@@ -464,19 +664,20 @@ struct unique<T*> {
     T* object = nullptr;
 };
 
+// ownership of objects with custom deleter (ex. `providers::arena`) can't be transferred by raw pointer
 template<class T, class TDeleter>
 struct unique<std::unique_ptr<T, TDeleter>> {
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(std::is_convertible<const T&, I>::value)>
     inline operator I() const noexcept {
         return *object;
     }
 
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(aux::always<I>::value && std::is_same<TDeleter, std::default_delete<T>>::value)>
     inline operator I*() noexcept {
         return object.release();
     }
 
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(aux::always<I>::value && std::is_same<TDeleter, std::default_delete<T>>::value)>
     inline operator const I*() noexcept {
         return object.release();
     }
@@ -491,7 +692,12 @@ struct unique<std::unique_ptr<T, TDeleter>> {
         return {object.release(), object.get_deleter()};
     }
 
-    template<class I, class D>
+    template<class I>
+    inline operator local_shared_ptr<I>() {
+        return local_shared_ptr<I>{std::move(object)};
+    }
+
+    template<class I, class D, BOOST_DI_REQUIRES(std::is_convertible<TDeleter, D>::value)>
     inline operator std::unique_ptr<I, D>() noexcept {
         return std::move(object);
     }
@@ -510,6 +716,8 @@ namespace boost { namespace di { inline namespace v1 { namespace type_traits {
 
 struct stack { };
 struct heap { };
+struct shared_heap { }; // heap, object and its reference counter in one allocation
+struct local_shared_heap { }; // heap, object and its reference counters (see `local_shared_ptr`) in one allocation
 
 template<class T, class = void>
 struct memory_traits {
@@ -586,6 +794,16 @@ struct memory_traits<const std::weak_ptr<T>&> {
     using type = heap;
 };
 
+template<class T>
+struct memory_traits<local_shared_ptr<T>> {
+    using type = heap;
+};
+
+template<class T>
+struct memory_traits<const local_shared_ptr<T>&> {
+    using type = heap;
+};
+
 template<class T>
 struct memory_traits<T, std::enable_if_t<std::is_polymorphic<T>::value>> {
     using type = heap;
@@ -636,7 +854,36 @@ public:
 
 namespace boost { namespace di { inline namespace v1 { namespace wrappers {
 
-template<class T, bool Ref = true>
+// instance kept by `shared` and `session` scopes, created from the provider with `shared_memory_t`
+#if defined(BOOST_DI_CFG_LOCAL_SHARED_PTR) // single-threaded, `local_shared_ptr` parameters don't touch atomic counters
+    template<class T>
+    struct shared_object : std::shared_ptr<T> { // `const std::shared_ptr<T>&` parameters are passed without copying it
+        shared_object() noexcept { }
+
+        explicit shared_object(local_shared_ptr<T> object) noexcept
+            : std::shared_ptr<T>{object.to_shared_ptr()}, local{std::move(object)}
+        { }
+
+        void reset() noexcept {
+            std::shared_ptr<T>::reset();
+            local.reset();
+        }
+
+        local_shared_ptr<T> local;
+    };
+
+    template<class T>
+    using shared_object_t = shared_object<T>;
+
+    using shared_memory_t = type_traits::local_shared_heap;
+#else
+    template<class T>
+    using shared_object_t = std::shared_ptr<T>;
+
+    using shared_memory_t = type_traits::shared_heap;
+#endif
+
+template<class T, bool Ref = true, class TObject = std::shared_ptr<std::remove_reference_t<T>>>
 struct shared {
     using type = std::conditional_t<std::is_same<T, void>::value, _, T>;
 
@@ -650,9 +897,43 @@ struct shared {
         : std::false_type
     { };
 
+    template<class I>
+    struct is_referable<local_shared_ptr<I>>
+        : std::false_type
+    { };
+
+    template<class I>
+    struct is_referable<const std::shared_ptr<I>&> // kept instance is passed without copying it
+        : std::integral_constant<bool, Ref && std::is_base_of<std::shared_ptr<I>, TObject>::value>
+    { };
+
+    template<class I>
+    struct is_referable<const local_shared_ptr<I>&> // copy doesn't touch atomic counters
+        : std::false_type
+    { };
+
+    static const std::shared_ptr<T>& to_shared_ptr(const std::shared_ptr<T>& sp) noexcept {
+        return sp;
+    }
+
+    static local_shared_ptr<T> to_local_shared_ptr(const std::shared_ptr<T>& sp) {
+        return local_shared_ptr<T>{sp}; // allocates the counter
+    }
+
+    #if defined(BOOST_DI_CFG_LOCAL_SHARED_PTR)
+        static const local_shared_ptr<T>& to_local_shared_ptr(const shared_object<T>& object) noexcept {
+            return object.local;
+        }
+    #endif
+
     template<class I>
     inline operator std::shared_ptr<I>() const noexcept {
-        return object;
+        return to_shared_ptr(object);
+    }
+
+    template<class I>
+    inline operator local_shared_ptr<I>() const {
+        return to_local_shared_ptr(object);
     }
 
     template<class TSharedPtr>
@@ -666,16 +947,21 @@ struct shared {
 
     template<class I>
     inline operator boost::shared_ptr<I>() const noexcept {
+        const auto& shared_object = to_shared_ptr(object);
         using sp = sp_holder<boost::shared_ptr<T>>;
-        if (auto* deleter = std::get_deleter<sp, T>(object)) {
+        if (auto* deleter = std::get_deleter<sp, T>(shared_object)) {
             return deleter->object;
         } else {
-            return {object.get(), sp_holder<std::shared_ptr<T>>{object}};
+            return {shared_object.get(), sp_holder<std::shared_ptr<T>>{shared_object}};
         }
     }
 
     template<class I>
     inline operator std::weak_ptr<I>() const noexcept {
+        return to_shared_ptr(object);
+    }
+
+    inline operator const TObject&() const noexcept {
         return object;
     }
 
@@ -687,7 +973,7 @@ struct shared {
         return *object;
     }
 
-    std::conditional_t<Ref, const std::shared_ptr<T>&, std::shared_ptr<T>> object;
+    std::conditional_t<Ref, const TObject&, TObject> object;
 };
 
 template<class T>
@@ -722,30 +1008,47 @@ class singleton {
 public:
     template<class, class T>
     class scope {
+        /**
+         * Constant initialized, so neither the fast path nor the first access pays a guard check
+         */
+        struct instance {
+            std::atomic<bool> is_created{false};
+            std::once_flag once;
+            std::shared_ptr<T> object;
+        };
+
     public:
         template<class T_>
         using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
 
         template<class, class TProvider>
         auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
 
         template<class, class TProvider>
         auto create(const TProvider& provider) {
-            if (BOOST_DI_UNLIKELY(!get_instance())) {
-                get_instance() = std::shared_ptr<T>{provider.get()};
+            if (BOOST_DI_UNLIKELY(!instance_.is_created.load(std::memory_order_acquire))) {
+                create_once(provider);
             }
-            return wrappers::shared<T>{get_instance()};
+            return wrappers::shared<T>{instance_.object};
         }
 
     private:
-        static std::shared_ptr<T>& get_instance() noexcept {
-            static std::shared_ptr<T> object;
-            return object;
+        template<class TProvider>
+        static void create_once(const TProvider& provider) {
+            std::call_once(instance_.once, [&provider] {
+                instance_.object = std::shared_ptr<T>{provider.get(type_traits::shared_heap{})};
+                instance_.is_created.store(true, std::memory_order_release);
+            });
         }
+
+        static instance instance_;
     };
 };
 
+template<class TExpected, class T>
+typename singleton::scope<TExpected, T>::instance singleton::scope<TExpected, T>::instance_{};
+
 }}}} // boost::di::v1::scopes
 
 #endif
@@ -830,6 +1133,16 @@ struct scope_traits<const std::weak_ptr<T>&> {
     using type = scopes::singleton;
 };
 
+template<class T>
+struct scope_traits<local_shared_ptr<T>> {
+    using type = scopes::singleton;
+};
+
+template<class T>
+struct scope_traits<const local_shared_ptr<T>&> {
+    using type = scopes::singleton;
+};
+
 template<class T>
 using scope_traits_t = typename scope_traits<T>::type;
 
@@ -886,34 +1199,49 @@ public:
           , TExpected*
         >;
 
-        struct iprovider {
-            virtual ~iprovider() noexcept = default;
-            virtual TExpected* get(const type_traits::heap& = {}) const noexcept = 0;
-            virtual type get(const type_traits::stack&) const noexcept = 0;
-            virtual iprovider* clone() const noexcept = 0;
-        };
-
-        template<class TInjector>
-        class provider_impl : public iprovider {
+        /**
+         * Module injector is shared between copies of the scope and called through function pointers
+         */
+        class provider_impl {
         public:
+            template<class TInjector>
             explicit provider_impl(const TInjector& injector) noexcept
+                : provider_impl{std::make_shared<TInjector>(injector)}
+            { }
+
+            template<class TInjector>
+            explicit provider_impl(const std::shared_ptr<TInjector>& injector) noexcept
                 : injector_(injector)
+                , heap_(&get_heap<TInjector>)
+                , stack_(&get_stack<TInjector>)
             { }
 
-            TExpected* get(const type_traits::heap&) const noexcept override {
-                return injector_.create_impl(aux::type<TExpected*>{});
+            TExpected* get(const type_traits::heap& = {}) const noexcept {
+                return heap_(injector_.get());
             }
 
-            type get(const type_traits::stack&) const noexcept override {
-                return injector_.create_impl(aux::type<type>{});
+            type get(const type_traits::stack&) const noexcept {
+                return stack_(injector_.get());
             }
 
-            iprovider* clone() const noexcept override {
-                return new provider_impl(*this); // non-ownership pointer
+            std::shared_ptr<TExpected> get(const type_traits::shared_heap&) const noexcept {
+                return std::shared_ptr<TExpected>{get(type_traits::heap{})};
             }
 
         private:
-            TInjector injector_;
+            template<class TInjector>
+            static TExpected* get_heap(const void* injector) noexcept {
+                return static_cast<const TInjector*>(injector)->create_impl(aux::type<TExpected*>{});
+            }
+
+            template<class TInjector>
+            static type get_stack(const void* injector) noexcept {
+                return static_cast<const TInjector*>(injector)->create_impl(aux::type<type>{});
+            }
+
+            std::shared_ptr<const void> injector_;
+            TExpected* (*heap_)(const void*) = nullptr;
+            type (*stack_)(const void*) = nullptr;
         };
 
     public:
@@ -922,11 +1250,19 @@ public:
 
         template<class TInjector>
         explicit scope(const TInjector& injector) noexcept
-            : provider_{new provider_impl<TInjector>(injector)}
+            : provider_{injector}
+        { }
+
+        /**
+         * Module state shared with other types exposed by the same injector
+         */
+        template<class TInjector>
+        explicit scope(const std::shared_ptr<TInjector>& injector) noexcept
+            : provider_{injector}
         { }
 
         explicit scope(const scope& other) noexcept
-            : provider_(other.provider_->clone())
+            : provider_(other.provider_)
         { }
 
         template<class T, class TProvider>
@@ -934,23 +1270,15 @@ public:
 
         template<class T, class TProvider>
         auto create(const TProvider&) {
-            return scope_.template create<T>(*provider_);
+            return scope_.template create<T>(provider_);
         }
 
     private:
-        std::unique_ptr<iprovider> provider_;
+        provider_impl provider_;
         typename TScope::template scope<TExpected, TGiven> scope_;
     };
 };
 
-#if defined(BOOST_DI_GCC)
-    template<class TScope>
-    template<class TExpected, class TGiven>
-    TExpected* exposed<TScope>::scope<TExpected, TGiven>::iprovider::get(const type_traits::heap&) const noexcept {
-        return nullptr;
-    }
-#endif
-
 }}}} // boost::di::v1::scopes
 
 #endif
@@ -993,19 +1321,32 @@ class external {
 public:
     template<class TExpected, class, class = void>
     struct scope {
+        /**
+         * Move-only objects can't be copied per creation, they are injected by reference instead
+         */
+        using wrapper = std::conditional_t<
+            std::is_copy_constructible<TExpected>::value
+          , wrappers::unique<TExpected>
+          , wrappers::shared<TExpected&>
+        >;
+
         template<class>
-        using is_referable = std::false_type;
+        using is_referable = std::integral_constant<bool, !std::is_copy_constructible<TExpected>::value>;
 
         explicit scope(const TExpected& object)
             : object_{object}
         { }
 
+        explicit scope(TExpected&& object)
+            : object_{std::move(object)}
+        { }
+
         template<class, class TProvider>
-        TExpected try_create(const TProvider&);
+        wrapper try_create(const TProvider&);
 
         template<class, class TProvider>
-        auto create(const TProvider&) const noexcept {
-            return wrappers::unique<TExpected>{object_};
+        auto create(const TProvider&) noexcept {
+            return wrapper{object_};
         }
 
         TExpected object_;
@@ -1043,6 +1384,10 @@ public:
             : object_{object}
         { }
 
+        explicit scope(std::shared_ptr<TGiven>&& object)
+            : object_{std::move(object)}
+        { }
+
         template<class, class TProvider>
         wrappers::shared<TGiven> try_create(const TProvider&);
 
@@ -1347,48 +1692,83 @@ struct get {
 template<class T, std::size_t N>
 using get_t = typename get<T, N>::type;
 
-template<template<class...> class, class, class, class = void>
+template<std::size_t N>
+struct ctor_priority : ctor_priority<N - 1> { };
+
+template<>
+struct ctor_priority<0> { };
+
+// `args` overloads for each number of constructor arguments, instantiated once for all types.
+// Single overload resolution of `args<T>(ctor_priority<2 * limit>{})` picks the longest constructor
+// (any_type_fwd before any_type_ref_fwd) without class template instantiations per arity.
+// Direct constructors are probed with a new-expression, `T(arg)` would be a functional cast.
+template<class, class>
 struct ctor_impl;
 
-template<template<class...> class TIsConstructible, class T, std::size_t... TArgs>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<TArgs...>
-    , BOOST_DI_REQUIRES_T((sizeof...(TArgs) > 0) && !TIsConstructible<T, get_t<core::any_type_fwd<T>, TArgs>...>::value)>
-    : std::conditional<
-           TIsConstructible<T, get_t<core::any_type_ref_fwd<T>, TArgs>...>::value
-         , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>
-         , typename ctor_impl<
-               TIsConstructible
-             , T
-             , std::make_index_sequence<sizeof...(TArgs) - 1>
-           >::type
-      >
-{ };
+struct ctor_impl_default {
+    template<class>
+    static aux::type_list<> args(const ctor_priority<0>&);
+};
 
-template<template<class...> class TIsConstructible, class T, std::size_t... TArgs>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<TArgs...>,
-      BOOST_DI_REQUIRES_T((sizeof...(TArgs) > 0) && TIsConstructible<T, get_t<core::any_type_fwd<T>, TArgs>...>::value)>
-    : aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>
+template<>
+struct ctor_impl<direct, std::index_sequence<>>
+    : ctor_impl_default
 { };
 
-template<template<class...> class TIsConstructible, class T>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<>>
-    : aux::type_list<>
+template<>
+struct ctor_impl<uniform, std::index_sequence<>>
+    : ctor_impl_default
 { };
 
-template<template<class...> class TIsConstructible, class T>
-using ctor_impl_t =
-    typename ctor_impl<
-        TIsConstructible
-      , T
-      , std::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>
-    >::type;
+template<std::size_t... TArgs>
+struct ctor_impl<direct, std::index_sequence<TArgs...>>
+    : ctor_impl<direct, std::make_index_sequence<sizeof...(TArgs) - 1>> {
+    using ctor_impl<direct, std::make_index_sequence<sizeof...(TArgs) - 1>>::args;
+
+    template<class T>
+    static decltype(
+        void(::new T(std::declval<get_t<core::any_type_fwd<T>, TArgs>>()...))
+      , aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2>&);
+
+    template<class T>
+    static decltype(
+        void(::new T(std::declval<get_t<core::any_type_ref_fwd<T>, TArgs>>()...))
+      , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2 - 1>&);
+};
+
+template<std::size_t... TArgs>
+struct ctor_impl<uniform, std::index_sequence<TArgs...>>
+    : ctor_impl<uniform, std::make_index_sequence<sizeof...(TArgs) - 1>> {
+    using ctor_impl<uniform, std::make_index_sequence<sizeof...(TArgs) - 1>>::args;
+
+    template<class T>
+    static decltype(
+        void(T{std::declval<get_t<core::any_type_fwd<T>, TArgs>>()...})
+      , aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2>&);
+
+    template<class T>
+    static decltype(
+        void(T{std::declval<get_t<core::any_type_ref_fwd<T>, TArgs>>()...})
+      , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2 - 1>&);
+};
+
+template<class TInitialization, class T>
+using ctor_impl_t = decltype(
+    ctor_impl<TInitialization, std::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>>::template args<T>(
+        ctor_priority<BOOST_DI_CFG_CTOR_LIMIT_SIZE * 2>{}
+    )
+);
 
 template<class...>
 struct ctor;
 
 template<class T>
 struct ctor<T, aux::type_list<>>
-    : aux::pair<uniform, ctor_impl_t<aux::is_braces_constructible, T>>
+    : aux::pair<uniform, ctor_impl_t<uniform, T>>
 { };
 
 template<class T, class... TArgs>
@@ -1400,7 +1780,7 @@ struct ctor<T, aux::type_list<TArgs...>>
 
 template<class T>
 struct ctor_traits
-    : type_traits::ctor<T, type_traits::ctor_impl_t<std::is_constructible, T>>
+    : type_traits::ctor<T, type_traits::ctor_impl_t<type_traits::direct, T>>
 { };
 
 namespace type_traits {
@@ -1541,6 +1921,10 @@ struct provider {
     T* get(const TMemory& = {}) const {
         return nullptr;
     }
+
+    local_shared_ptr<T> get(const type_traits::local_shared_heap&) const {
+        return nullptr;
+    }
 };
 
 std::false_type scopable_impl(...);
@@ -2025,7 +2409,7 @@ template<class T>
 using ctor_size_t = ctor_size<
     typename type_traits::ctor<
         aux::decay_t<T>
-      , type_traits::ctor_impl_t<std::is_constructible, aux::decay_t<T>>
+      , type_traits::ctor_impl_t<type_traits::direct, aux::decay_t<T>>
     >::type
 >;
 
@@ -2112,6 +2496,32 @@ public:
         return new T{std::forward<TArgs>(args)...};
     }
 
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::shared_heap&
+           , TArgs&&... args) {
+        return std::make_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::shared_heap&) {
+        return std::make_shared<T>();
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::local_shared_heap&
+           , TArgs&&... args) {
+        return make_local_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::local_shared_heap&) {
+        return make_local_shared<T>();
+    }
+
     template<class, class T, class... TArgs>
     auto get(const type_traits::direct&
            , const type_traits::stack&
@@ -2179,8 +2589,9 @@ public:
     template<class, class T>
     class scope {
     public:
+        // instance is reset by `session_exit`, so `const std::shared_ptr<T>&` parameters get a copy instead of referring to it
         template<class T_>
-        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+        using is_referable = typename wrappers::shared<T, false, wrappers::shared_object_t<T>>::template is_referable<T_>;
 
         void call(const session_entry<TName>&) noexcept {
             in_scope_ = true;
@@ -2193,53 +2604,226 @@ public:
 
         template<class, class TProvider>
         auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            -> decltype(wrappers::shared<T, false, wrappers::shared_object_t<T>>{wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})}});
 
         template<class, class TProvider>
         auto create(const TProvider& provider) {
             if (BOOST_DI_LIKELY(in_scope_) && BOOST_DI_UNLIKELY(!object_)) {
-                object_ = std::shared_ptr<T>{provider.get()};
+                object_ = wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})};
             }
-            return wrappers::shared<T>{object_};
+            return wrappers::shared<T, false, wrappers::shared_object_t<T>>{object_};
         }
 
     private:
-        std::shared_ptr<T> object_;
+        wrappers::shared_object_t<T> object_;
         bool in_scope_ = false;
     };
 };
 
-}}}} // boost::di::v1::scopes
-
-#endif
-
-#ifndef BOOST_DI_SCOPES_SHARED_HPP
-#define BOOST_DI_SCOPES_SHARED_HPP
-
-namespace boost { namespace di { inline namespace v1 { namespace scopes {
-
-class shared {
+template<class TName = no_name>
+class session_mt {
 public:
+    /**
+     * Thread-safe version of session scope
+     * Readers never lock, they announce themselves in the counter of the current epoch whilst copying the instance,
+     * `session_exit` starts the next epoch under the lock, then, without holding it, waits only for readers of the previous one before releasing the instance
+     * `session_exit` calls are serialized until the end of the wait, so that two of them never release instances of overlapping epochs
+     */
     template<class, class T>
     class scope {
-    public:
-        template<class T_>
-        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+        // instance owned by the scope, published to readers by its address
+        class atomic_object {
+        public:
+            using object_t = std::unique_ptr<std::shared_ptr<T>>;
 
-        template<class, class TProvider>
-        auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            atomic_object() noexcept { }
+            atomic_object(const atomic_object&) = delete;
+            atomic_object& operator=(const atomic_object&) = delete;
 
-        template<class, class TProvider>
+            ~atomic_object() noexcept {
+                exchange(nullptr);
+            }
+
+            std::shared_ptr<T>* load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return object_.load(order);
+            }
+
+            object_t exchange(object_t object) noexcept {
+                return object_t{object_.exchange(object.release())};
+            }
+
+        private:
+            std::atomic<std::shared_ptr<T>*> object_{nullptr};
+        };
+
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T, false>::template is_referable<T_>;
+
+        scope() noexcept { }
+
+        scope(const scope& other) {
+            std::lock_guard<std::mutex> lock{other.mutex_};
+            in_scope_.store(other.in_scope_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            if (auto object = other.object_.load(std::memory_order_relaxed)) {
+                object_.exchange(std::make_unique<std::shared_ptr<T>>(*object));
+            }
+        }
+
+        void call(const session_entry<TName>&) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            in_scope_.store(true, std::memory_order_relaxed);
+        }
+
+        void call(const session_exit<TName>&) {
+            std::lock_guard<std::mutex> exit_lock{exit_mutex_}; // held until readers of the previous epoch left
+            typename atomic_object::object_t object; // released once readers of the previous epoch left
+            auto epoch = std::size_t{0};
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                in_scope_.store(false, std::memory_order_relaxed);
+                object = object_.exchange(nullptr);
+                epoch = epoch_.fetch_add(1);
+            }
+            // not under the lock, so that `session_entry` and creation of the next instance don't wait for readers
+            // seq_cst, as the epoch and the counters of readers (see `enter`), otherwise a reader of the old instance might be missed
+            while (readers_[epoch & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T, false>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            const auto epoch = enter();
+            auto object = object_.load();
+            if (BOOST_DI_LIKELY(object != nullptr)) {
+                std::shared_ptr<T> result{*object};
+                leave(epoch);
+                return wrappers::shared<T, false>{result};
+            }
+            leave(epoch);
+            return wrappers::shared<T, false>{create_impl(provider)};
+        }
+
+    private:
+        std::size_t enter() noexcept {
+            for (;;) {
+                const auto epoch = epoch_.load();
+                readers_[epoch & 1].fetch_add(1);
+                if (BOOST_DI_LIKELY(epoch_.load() == epoch)) {
+                    return epoch & 1;
+                }
+                leave(epoch & 1); // `session_exit` started the next epoch in the meantime
+            }
+        }
+
+        void leave(std::size_t epoch) noexcept {
+            readers_[epoch].fetch_sub(1, std::memory_order_release);
+        }
+
+        template<class TProvider>
+        std::shared_ptr<T> create_impl(const TProvider& provider) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!in_scope_.load(std::memory_order_relaxed)) {
+                return {};
+            }
+            if (auto object = object_.load(std::memory_order_relaxed)) {
+                return *object;
+            }
+            auto object = std::make_unique<std::shared_ptr<T>>(provider.get(type_traits::shared_heap{}));
+            std::shared_ptr<T> result{*object};
+            object_.exchange(std::move(object));
+            return result;
+        }
+
+        atomic_object object_;
+        std::atomic<std::size_t> epoch_{0};
+        std::atomic<int> readers_[2] = {{0}, {0}};
+        mutable std::mutex mutex_;
+        std::mutex exit_mutex_;
+        std::atomic<bool> in_scope_{false};
+    };
+};
+
+}}}} // boost::di::v1::scopes
+
+#endif
+
+#ifndef BOOST_DI_SCOPES_SHARED_HPP
+#define BOOST_DI_SCOPES_SHARED_HPP
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+class shared {
+public:
+    template<class, class T>
+    class scope {
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T, true, wrappers::shared_object_t<T>>::template is_referable<T_>;
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T, true, wrappers::shared_object_t<T>>{wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})}});
+
+        template<class, class TProvider>
         auto create(const TProvider& provider) {
             if (BOOST_DI_UNLIKELY(!object_)) {
-                object_ = std::shared_ptr<T>{provider.get()};
+                object_ = wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})};
+            }
+            return wrappers::shared<T, true, wrappers::shared_object_t<T>>{object_};
+        }
+
+    private:
+        wrappers::shared_object_t<T> object_;
+    };
+};
+
+class shared_mt {
+public:
+    /**
+     * Thread-safe version of shared scope
+     * Instance is published once and never changes afterwards, so readers don't lock
+     */
+    template<class, class T>
+    class scope {
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+
+        scope() noexcept { }
+
+        scope(const scope& other) noexcept {
+            if (other.is_created_.load(std::memory_order_acquire)) {
+                object_ = other.object_;
+                is_created_.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            if (BOOST_DI_UNLIKELY(!is_created_.load(std::memory_order_acquire))) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (!object_) {
+                    object_ = std::shared_ptr<T>{provider.get(type_traits::shared_heap{})};
+                    is_created_.store(true, std::memory_order_release);
+                }
             }
             return wrappers::shared<T>{object_};
         }
 
     private:
         std::shared_ptr<T> object_;
+        std::atomic<bool> is_created_{false};
+        std::mutex mutex_;
     };
 };
 
@@ -2247,6 +2831,153 @@ public:
 
 #endif
 
+#ifndef BOOST_DI_CORE_BINDER_HPP
+#define BOOST_DI_CORE_BINDER_HPP
+
+namespace boost { namespace di { inline namespace v1 { namespace core {
+
+class binder;
+
+// parent of the child injector, types not bound by the child are resolved by its bindings
+template<class TInjector>
+class parent {
+    friend class binder;
+
+public:
+    explicit parent(const TInjector& injector) noexcept
+        : parent_(&injector)
+    { }
+
+private:
+    const TInjector* parent_ = nullptr;
+};
+
+template<class T>
+struct get_parent {
+    using type = aux::type_list<>;
+};
+
+template<class TInjector>
+struct get_parent<parent<TInjector>> {
+    using type = aux::type_list<parent<TInjector>>;
+};
+
+template<class... Ts>
+using parents_t = aux::join_t<typename get_parent<Ts>::type...>;
+
+class binder {
+public:
+    static void parent_impl(...) noexcept;
+
+    template<class TInjector>
+    static TInjector parent_impl(const parent<TInjector>*) noexcept;
+
+private:
+    template<class TDefault, class>
+    static TDefault resolve_impl(...) noexcept;
+
+    template<class, class TConcept, class TDependency>
+    static TDependency& resolve_impl(aux::pair<TConcept, TDependency>*) noexcept;
+
+    template<
+        class
+      , class TConcept
+      , class TScope
+      , class TExpected
+      , class TGiven
+      , class TName
+    > static dependency<TScope, TExpected, TGiven, TName, override>&
+    resolve_impl(aux::pair<TConcept, dependency<TScope, TExpected, TGiven, TName, override>>*) noexcept;
+
+    template<class TDeps>
+    struct parent_type { // parents are private bases of injectors
+        using type = decltype(parent_impl((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class T, class TName, class TDefault, class TParent = typename parent_type<TDeps>::type>
+    struct resolve_type { // bindings of the parent are the default of the child
+        using type = decltype(resolve_impl<
+            typename resolve_type<TParent, T, TName, TDefault>::type
+          , dependency_concept<aux::decay_t<T>, TName>
+        >((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class T, class TName, class TDefault>
+    struct resolve_type<TDeps, T, TName, TDefault, void> {
+        using type = decltype(resolve_impl<TDefault, dependency_concept<aux::decay_t<T>, TName>>((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class TDependency, class TParent = typename parent_type<TDeps>::type>
+    struct owner_type {
+        using type = std::conditional_t<
+            std::is_base_of<TDependency, TDeps>::value
+          , TDeps
+          , typename owner_type<TParent, TDependency>::type
+        >;
+    };
+
+    template<class TDependency>
+    struct owner_type<void, TDependency, void> {
+        using type = void;
+    };
+
+public:
+    /**
+     * Bound dependency (reference) or `TDefault`, memoized per requested type and name
+     */
+    template<
+        class TDeps
+      , class T
+      , class TName = no_name
+      , class TDefault = dependency<scopes::deduce, aux::decay_t<T>>
+    > using resolve_t = typename resolve_type<TDeps, T, TName, TDefault>::type;
+
+    /**
+     * Symbols depend on the dependency type only, not on the (possibly huge) injector type
+     */
+    template<class TDependency>
+    static std::enable_if_t<std::is_reference<TDependency>::value, TDependency>
+    get(std::remove_reference_t<TDependency>* dep) noexcept {
+        return *dep;
+    }
+
+    template<class TDependency, class TDeps, BOOST_DI_REQUIRES(
+        std::is_reference<TDependency>::value && !std::is_base_of<std::remove_reference_t<TDependency>, TDeps>::value
+    )> static TDependency get(TDeps* deps) noexcept { // bound by the parent
+        return get<TDependency>(parent_of(deps));
+    }
+
+    template<class TDefault>
+    static std::enable_if_t<!std::is_reference<TDefault>::value, TDefault>
+    get(const void*) noexcept {
+        return {};
+    }
+
+    template<class TInjector>
+    static TInjector* parent_of(const parent<TInjector>* deps) noexcept {
+        return const_cast<TInjector*>(deps->parent_);
+    }
+
+    /**
+     * Injector (`TDeps` or one of its parents) which binds `TDependency`
+     */
+    template<class TDeps, class TDependency>
+    using owner_t = typename owner_type<TDeps, TDependency>::type;
+
+    template<
+        class T
+      , class TName = no_name
+      , class TDefault = dependency<scopes::deduce, aux::decay_t<T>>
+      , class TDeps = void
+    > static resolve_t<TDeps, T, TName, TDefault> resolve(TDeps* deps) noexcept {
+        return get<resolve_t<TDeps, T, TName, TDefault>>(deps);
+    }
+};
+
+}}}} // boost::di::v1::core
+
+#endif
+
 #ifndef BOOST_DI_CORE_TRANSFORM_HPP
 #define BOOST_DI_CORE_TRANSFORM_HPP
 
@@ -2287,6 +3018,11 @@ struct add_type_list<T, std::false_type, std::false_type> {
     using type = aux::type_list<dependency<scopes::exposed<>, T>>;
 };
 
+template<class TInjector>
+struct add_type_list<parent<TInjector>, std::false_type, std::false_type> { // kept by the pool, see `parents_t`
+    using type = aux::type_list<>;
+};
+
 #if defined(BOOST_DI_MSVC)
     template<class... Ts>
     struct transform : aux::join_t<typename add_type_list<Ts>::type...> { };
@@ -2475,6 +3211,7 @@ constexpr core::override override{};
 constexpr scopes::deduce deduce{};
 constexpr scopes::unique unique{};
 constexpr scopes::shared shared{};
+constexpr scopes::shared_mt shared_mt{};
 constexpr scopes::singleton singleton{};
 
 template<class TName>
@@ -2482,6 +3219,11 @@ constexpr auto session(const TName&) noexcept {
     return scopes::session<TName>{};
 }
 
+template<class TName>
+constexpr auto session_mt(const TName&) noexcept {
+    return scopes::session_mt<TName>{};
+}
+
 template<class TName>
 constexpr auto session_entry(const TName&) noexcept {
     return scopes::session_entry<TName>{};
@@ -2496,52 +3238,6 @@ constexpr auto session_exit(const TName&) noexcept {
 
 #endif
 
-#ifndef BOOST_DI_CORE_BINDER_HPP
-#define BOOST_DI_CORE_BINDER_HPP
-
-namespace boost { namespace di { inline namespace v1 { namespace core {
-
-class binder {
-    template<class TDefault, class>
-    static TDefault resolve_impl(...) noexcept {
-        return {};
-    }
-
-    template<class, class TConcept, class TDependency>
-    static decltype(auto)
-    resolve_impl(aux::pair<TConcept, TDependency>* dep) noexcept {
-        return static_cast<TDependency&>(*dep);
-    }
-
-    template<
-        class
-      , class TConcept
-      , class TScope
-      , class TExpected
-      , class TGiven
-      , class TName
-    > static decltype(auto)
-    resolve_impl(aux::pair<TConcept
-               , dependency<TScope, TExpected, TGiven, TName, override>>* dep) noexcept {
-        return static_cast<dependency<TScope, TExpected, TGiven, TName, override>&>(*dep);
-    }
-
-public:
-    template<
-        class T
-      , class TName = no_name
-      , class TDefault = dependency<scopes::deduce, aux::decay_t<T>>
-      , class TDeps = void
-    > static decltype(auto) resolve(TDeps* deps) noexcept {
-        using dependency = dependency_concept<aux::decay_t<T>, TName>;
-        return resolve_impl<TDefault, dependency>(deps);
-    }
-};
-
-}}}} // boost::di::v1::core
-
-#endif
-
 #ifndef BOOST_DI_CORE_ANY_TYPE_HPP
 #define BOOST_DI_CORE_ANY_TYPE_HPP
 
@@ -2553,7 +3249,7 @@ using is_not_same = std::enable_if_t<!aux::is_same_or_base_of<T, TParent>::value
 template<class T, class TInjector>
 struct is_referable_impl {
     static constexpr auto value =
-        std::remove_reference_t<decltype(binder::resolve<T>((TInjector*)nullptr))>::template
+        std::remove_reference_t<binder::resolve_t<TInjector, T>>::template
             is_referable<T>::value;
 };
 
@@ -2588,6 +3284,14 @@ struct any_type {
         return injector_.create_impl(aux::type<T>{});
     }
 
+    template<class T
+           , class = is_not_same<T, TParent>
+           , class = is_referable<const std::shared_ptr<T>&, TInjector>
+           , class = is_creatable<const std::shared_ptr<T>&, TInjector, TError>
+    > operator const std::shared_ptr<T>&() const { // kept instance is passed without copying it
+        return injector_.create_impl(aux::type<const std::shared_ptr<T>&>{});
+    }
+
     const TInjector& injector_;
 };
 
@@ -2631,21 +3335,28 @@ struct any_type_ref {
 
 namespace successful {
 
-template<class TParent, class TInjector>
+template<class TParent, class TInjector, class TCallPolicies = std::true_type>
 struct any_type {
     template<class T, class = is_not_same<T, TParent>>
     operator T() {
-        return injector_.create_successful_impl(aux::type<T>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T>{});
+    }
+
+    template<class T
+           , class = is_not_same<T, TParent>
+           , class = is_referable<const std::shared_ptr<T>&, TInjector>
+    > operator const std::shared_ptr<T>&() const {
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<const std::shared_ptr<T>&>{});
     }
 
     const TInjector& injector_;
 };
 
-template<class TParent, class TInjector>
+template<class TParent, class TInjector, class TCallPolicies = std::true_type>
 struct any_type_ref {
     template<class T, class = is_not_same<T, TParent>>
     operator T() {
-        return injector_.create_successful_impl(aux::type<T>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T>{});
     }
 
     #if defined(BOOST_DI_GCC)
@@ -2653,7 +3364,7 @@ struct any_type_ref {
                , class = is_not_same<T, TParent>
                , class = is_referable<T&&, TInjector>
         > operator T&&() const {
-            return injector_.create_successful_impl(aux::type<T&&>{});
+            return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T&&>{});
         }
     #endif
 
@@ -2661,14 +3372,14 @@ struct any_type_ref {
            , class = is_not_same<T, TParent>
            , class = is_referable<T&, TInjector>
     > operator T&() const {
-        return injector_.create_successful_impl(aux::type<T&>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T&>{});
     }
 
     template<class T
            , class = is_not_same<T, TParent>
            , class = is_referable<const T&, TInjector>
     > operator const T&() const {
-        return injector_.create_successful_impl(aux::type<const T&>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<const T&>{});
     }
 
     const TInjector& injector_;
@@ -2736,6 +3447,9 @@ using copyable = typename copyable_impl<TDeps>::type;
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
 BOOST_DI_HAS_METHOD(call_operator, operator());
+BOOST_DI_HAS_METHOD(created, created);
+BOOST_DI_HAS_METHOD(cached, cached);
+BOOST_DI_HAS_METHOD(failed, failed);
 
 template<
     class T
@@ -2750,7 +3464,7 @@ template<
     using ignore = TIgnore;
 
     template<class T_, class TName_, class TDefault_>
-    using resolve = decltype(core::binder::resolve<T_, TName_, TDefault_>((TDeps*)0));
+    using resolve = core::binder::resolve_t<TDeps, T_, TName_, TDefault_>;
 };
 
 template<class T>
@@ -2786,6 +3500,47 @@ class policy {
         (policy)(TArg{}, dependency, aux::type<TCtor>{}...);
     }
 
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void created_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        created_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_created<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void created_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.created(TArg{}, dependency);
+    }
+
+    template<class, class TPolicy, class TDependency>
+    static void created_impl__(const TPolicy&, TDependency&, const std::false_type&) noexcept { }
+
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void cached_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        cached_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_cached<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void cached_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.cached(TArg{}, dependency);
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void cached_impl__(const TPolicy& policies, TDependency& dependency, const std::false_type&) noexcept {
+        created_impl__<TArg>(policies, dependency, has_created<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void failed_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        failed_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_failed<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void failed_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.failed(TArg{}, dependency);
+    }
+
+    template<class, class TPolicy, class TDependency>
+    static void failed_impl__(const TPolicy&, TDependency&, const std::false_type&) noexcept { }
+
     template<class, class, class, class, class = void>
     struct try_call_impl;
 
@@ -2819,6 +3574,83 @@ public:
                    , BOOST_DI_UNUSED const TCtor& ctor) noexcept {
         int _[]{0, (call_impl<TArg, TPolicies>(policies, dependency, ctor), 0)...}; (void)_;
     }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void created(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                      , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (created_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void cached(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                     , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (cached_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void failed(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                     , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (failed_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    /**
+     * Calls `created` once the object was created, `failed` when its creation threw
+     * and `cached` (`created` unless defined) when scope keeping instances returned it without calling the provider
+     */
+    template<class TArg, class TPolicies, class TDependency, class TKeepsInstances = std::false_type>
+    class guard {
+    public:
+        // marks the object as created when the scope calls the provider
+        template<class TProvider>
+        class provider : public TProvider {
+        public:
+            provider(const TProvider& provider, guard& guard) noexcept
+                : TProvider(provider), guard_(guard)
+            { }
+
+            template<class TMemory = type_traits::heap>
+            auto get(const TMemory& memory = {}) const {
+                guard_.provided_ = true;
+                return TProvider::get(memory);
+            }
+
+        private:
+            guard& guard_;
+        };
+
+        guard(const TPolicies& policies, TDependency& dependency) noexcept
+            : policies_(policies), dependency_(dependency)
+        { }
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+        ~guard() noexcept {
+            if (!created_) {
+                policy::failed<TArg>(policies_, dependency_);
+            }
+        }
+
+        template<class TProvider>
+        auto make_provider(const TProvider& provider) noexcept {
+            return guard::provider<TProvider>{provider, *this};
+        }
+
+        void created() noexcept {
+            created_ = true;
+            if (TKeepsInstances::value && !provided_) {
+                policy::cached<TArg>(policies_, dependency_);
+            } else {
+                policy::created<TArg>(policies_, dependency_);
+            }
+        }
+
+    private:
+        const TPolicies& policies_;
+        TDependency& dependency_;
+        bool created_ = false;
+        bool provided_ = false;
+    };
 };
 
 }}}} // boost::di::v1::core
@@ -2830,9 +3662,92 @@ public:
 
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class TMemory, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const TMemory& memory, TArgs&&... args) {
+    return provider.template get<TExpected, TGiven>(initialization, memory, std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_shared(TProvider&& provider, const TInitialization& initialization, int, TArgs&&... args)
+    -> decltype(std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::shared_heap{}, std::forward<TArgs>(args)...)}) {
+    return std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::shared_heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TGiven, class TProvider>
+using provider_allocator_t = typename std::allocator_traits<
+    aux::decay_t<decltype(std::declval<TProvider&>().allocator())>
+>::template rebind_alloc<TGiven>;
+
+template<class TExpected, class TGiven, class TProvider, class... TArgs>
+inline auto provide_allocate_shared(TProvider&& provider, const type_traits::direct&, int, TArgs&&... args)
+    -> decltype(std::allocate_shared<TGiven>(std::declval<provider_allocator_t<TGiven, TProvider>>(), std::forward<TArgs>(args)...)) {
+    return std::allocate_shared<TGiven>(provider_allocator_t<TGiven, TProvider>(provider.allocator()), std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider>
+inline auto provide_allocate_shared(TProvider&& provider, const type_traits::uniform&, int)
+    -> decltype(std::allocate_shared<TGiven>(std::declval<provider_allocator_t<TGiven, TProvider>>())) {
+    return std::allocate_shared<TGiven>(provider_allocator_t<TGiven, TProvider>(provider.allocator()));
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_allocate_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return provide_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
+// providers with `allocator()` allocate shared instances and their reference counters at once with it (`std::allocate_shared`),
+// uniform initialization with arguments is left to the provider, which can't be done by `std::allocate_shared`
+// providers without `shared_heap` support are asked for `heap` and the result is wrapped by std::shared_ptr
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const type_traits::shared_heap&, TArgs&&... args) {
+    return provide_allocate_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_local_shared(TProvider&& provider, const TInitialization& initialization, int, TArgs&&... args)
+    -> decltype(local_shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::local_shared_heap{}, std::forward<TArgs>(args)...)}) {
+    return local_shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::local_shared_heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_local_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return local_shared_ptr<TGiven>{provide_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...)};
+}
+
+// providers without `local_shared_heap` support are asked for `shared_heap` and the result is wrapped by `local_shared_ptr`
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const type_traits::local_shared_heap&, TArgs&&... args) {
+    return provide_local_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
 template<class, class, class, class>
 struct try_provider;
 
+template<class TGiven, class TMemory>
+struct provided_type {
+    using type = TGiven*;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::stack> {
+    using type = TGiven;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::shared_heap> {
+    using type = std::shared_ptr<TGiven>;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::local_shared_heap> {
+    using type = local_shared_ptr<TGiven>;
+};
+
 template<
     class TGiven
   , class TInjector
@@ -2854,7 +3769,7 @@ template<
     template<class TMemory = type_traits::heap>
     auto get(const TMemory& memory = {}) const -> std::enable_if_t<
         is_creatable<TMemory>::value
-      , std::conditional_t<std::is_same<TMemory, type_traits::stack>::value, TGiven, TGiven*>
+      , typename provided_type<TGiven, TMemory>::type
     >;
 };
 
@@ -2869,6 +3784,7 @@ template<
   , class TInitialization
   , class... TCtor
 > struct provider<TExpected, TGiven, TName, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector> {
+    using name = TName;
     using provider_t = decltype(std::declval<TInjector>().provider());
 
     template<class TMemory, class... TArgs>
@@ -2884,8 +3800,9 @@ template<
 
     template<class TMemory, class... TArgs, BOOST_DI_REQUIRES(is_creatable<TMemory, TArgs...>::value)>
     auto get_impl(const TMemory& memory, TArgs&&... args) const {
-        return injector_.provider().template get<TExpected, TGiven>(
-            TInitialization{}
+        return provide<TExpected, TGiven>(
+            injector_.provider()
+          , TInitialization{}
           , memory
           , std::forward<TArgs>(args)...
         );
@@ -2901,22 +3818,27 @@ template<
 
 namespace successful {
 
-template<class, class, class, class>
+template<class, class, class, class, class, class = std::true_type>
 struct provider;
 
 template<
     class TExpected
   , class TGiven
+  , class TName
   , class TInjector
+  , class TCallPolicies
   , class TInitialization
   , class... TCtor
-> struct provider<TExpected, TGiven, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector> {
+> struct provider<TExpected, TGiven, TName, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector, TCallPolicies> {
+    using name = TName;
+
     template<class TMemory = type_traits::heap>
     auto get(const TMemory& memory = {}) const {
-        return injector_.provider().template get<TExpected, TGiven>(
-            TInitialization{}
+        return provide<TExpected, TGiven>(
+            injector_.provider()
+          , TInitialization{}
           , memory
-          , injector_.create_successful_impl(aux::type<TCtor>{})...
+          , injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<TCtor>{})...
         );
     }
 
@@ -2990,59 +3912,234 @@ using wrapper = wrapper_impl<T, TWrapper>;
 
 #endif
 
-#ifndef BOOST_DI_TYPE_TRAITS_CONFIG_TRAITS_HPP
-#define BOOST_DI_TYPE_TRAITS_CONFIG_TRAITS_HPP
+#ifndef BOOST_DI_TYPE_TRAITS_CONFIG_TRAITS_HPP
+#define BOOST_DI_TYPE_TRAITS_CONFIG_TRAITS_HPP
+
+namespace boost { namespace di { inline namespace v1 { namespace type_traits {
+
+template<class TConfig, class>
+struct config_traits {
+    using type = TConfig;
+};
+
+template<template<class> class TConfig, class T, class TInjector>
+struct config_traits<TConfig<T>, TInjector> {
+    using type = TConfig<TInjector>;
+};
+
+template<class TConfig, class TInjector>
+using config_traits_t = typename config_traits<TConfig, TInjector>::type;
+
+}}}} // boost::di::v1::type_traits
+
+#endif
+
+#ifndef BOOST_DI_TYPE_TRAITS_REFERABLE_TRAITS_HPP
+#define BOOST_DI_TYPE_TRAITS_REFERABLE_TRAITS_HPP
+
+namespace boost { namespace di { inline namespace v1 { namespace type_traits {
+
+template<class T, class>
+struct referable_traits {
+    using type = T;
+};
+
+template<class T, class TDependency>
+struct referable_traits<T&, TDependency> {
+    using type = std::conditional_t<TDependency::template is_referable<T&>::value, T&, T>;
+};
+
+template<class T, class TDependency>
+struct referable_traits<const T&, TDependency> {
+    using type = std::conditional_t<TDependency::template is_referable<const T&>::value, const T&, T>;
+};
+
+#if defined(BOOST_DI_MSVC)
+    template<class T, class TDependency>
+    struct referable_traits<T&&, TDependency> {
+        using type = std::conditional_t<TDependency::template is_referable<T&&>::value, T&&, T>;
+    };
+#endif
+
+template<class T, class TDependency>
+using referable_traits_t = typename referable_traits<T, TDependency>::type;
+
+}}}} // boost::di::v1::type_traits
+
+#endif
+
+#ifndef BOOST_DI_LAZY_HPP
+#define BOOST_DI_LAZY_HPP
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace aux {
+
+template<class T>
+class lazy_object {
+public:
+    template<class TCreate>
+    void construct(const TCreate& create) {
+        new (&storage_) T(create());
+    }
+
+    void destroy() noexcept {
+        get().~T();
+    }
+
+    T& get() noexcept {
+        return *reinterpret_cast<T*>(&storage_);
+    }
+
+private:
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage_;
+};
+
+template<class T>
+class lazy_object<T&> {
+public:
+    template<class TCreate>
+    void construct(const TCreate& create) {
+        object_ = std::addressof(create());
+    }
+
+    void destroy() noexcept { }
+
+    T& get() const noexcept {
+        return *object_;
+    }
+
+private:
+    T* object_ = nullptr;
+};
+
+template<class>
+class lazy_once;
+
+template<>
+class lazy_once<std::false_type> {
+public:
+    lazy_once() noexcept = default;
+
+    explicit lazy_once(bool done) noexcept
+        : done_(done)
+    { }
+
+    bool is_done() const noexcept {
+        return done_;
+    }
+
+    template<class TCall>
+    void call(const TCall& call) {
+        call();
+        done_ = true;
+    }
+
+private:
+    bool done_ = false;
+};
+
+// double-checked, `call` which threw is repeated by the next caller
+template<>
+class lazy_once<std::true_type> {
+public:
+    lazy_once() noexcept = default;
+
+    explicit lazy_once(bool done) noexcept
+        : done_(done)
+    { }
+
+    bool is_done() const noexcept {
+        return done_.load(std::memory_order_acquire);
+    }
+
+    template<class TCall>
+    void call(const TCall& call) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (!done_.load(std::memory_order_relaxed)) {
+            call();
+            done_.store(true, std::memory_order_release);
+        }
+    }
+
+private:
+    std::atomic<bool> done_{false};
+    std::mutex mutex_;
+};
+
+template<class T>
+inline T* lazy_arrow(T& object, const std::false_type&) noexcept {
+    return std::addressof(object);
+}
+
+template<class T>
+inline T& lazy_arrow(T& object, const std::true_type&) noexcept { // `operator->` of pointers is applied afterwards
+    return object;
+}
 
-namespace boost { namespace di { inline namespace v1 { namespace type_traits {
+} // aux
 
-template<class TConfig, class>
-struct config_traits {
-    using type = TConfig;
-};
+// constructor parameter creating `T` on the first use through the binding of `T` (scope, provider, policies)
+// `lazy_mt<T>` may be used by many threads at the same time, `T` is created once, injector has to outlive both of them
+template<class T, class TThreadSafe = std::false_type>
+class lazy {
+    using create_t = T (*)(const void*);
 
-template<template<class> class TConfig, class T, class TInjector>
-struct config_traits<TConfig<T>, TInjector> {
-    using type = TConfig<TInjector>;
-};
+public:
+    using element_type = T;
 
-template<class TConfig, class TInjector>
-using config_traits_t = typename config_traits<TConfig, TInjector>::type;
+    lazy(const void* injector, create_t create) noexcept
+        : injector_(injector), create_(create)
+    { }
 
-}}}} // boost::di::v1::type_traits
+    lazy(lazy&& other)
+        : injector_(other.injector_), create_(other.create_), once_(other.once_.is_done()) {
+        if (other.once_.is_done()) {
+            object_.construct([&]() -> T { return std::forward<T>(other.object_.get()); });
+        }
+    }
 
-#endif
+    ~lazy() noexcept {
+        if (once_.is_done()) {
+            object_.destroy();
+        }
+    }
 
-#ifndef BOOST_DI_TYPE_TRAITS_REFERABLE_TRAITS_HPP
-#define BOOST_DI_TYPE_TRAITS_REFERABLE_TRAITS_HPP
+    /**
+     * Creates `T` when it wasn't created yet
+     */
+    std::add_lvalue_reference_t<T> get() const {
+        if (BOOST_DI_UNLIKELY(!once_.is_done())) {
+            once_.call([this] { object_.construct([this]() -> T { return create_(injector_); }); });
+        }
+        return object_.get();
+    }
 
-namespace boost { namespace di { inline namespace v1 { namespace type_traits {
+    std::add_lvalue_reference_t<T> operator*() const {
+        return get();
+    }
 
-template<class T, class>
-struct referable_traits {
-    using type = T;
-};
+    decltype(auto) operator->() const {
+        using is_pointer = std::integral_constant<bool,
+            aux::is_smart_ptr<std::remove_cv_t<std::remove_reference_t<T>>>::value || std::is_pointer<std::remove_reference_t<T>>::value>;
+        return aux::lazy_arrow(get(), is_pointer{});
+    }
 
-template<class T, class TDependency>
-struct referable_traits<T&, TDependency> {
-    using type = std::conditional_t<TDependency::template is_referable<T&>::value, T&, T>;
-};
+    bool is_created() const noexcept {
+        return once_.is_done();
+    }
 
-template<class T, class TDependency>
-struct referable_traits<const T&, TDependency> {
-    using type = std::conditional_t<TDependency::template is_referable<const T&>::value, const T&, T>;
+private:
+    const void* injector_ = nullptr;
+    create_t create_ = nullptr;
+    mutable aux::lazy_once<TThreadSafe> once_;
+    mutable aux::lazy_object<T> object_;
 };
 
-#if defined(BOOST_DI_MSVC)
-    template<class T, class TDependency>
-    struct referable_traits<T&&, TDependency> {
-        using type = std::conditional_t<TDependency::template is_referable<T&&>::value, T&&, T>;
-    };
-#endif
-
-template<class T, class TDependency>
-using referable_traits_t = typename referable_traits<T, TDependency>::type;
+template<class T>
+using lazy_mt = lazy<T, std::true_type>;
 
-}}}} // boost::di::v1::type_traits
+}}} // boost::di::v1
 
 #endif
 
@@ -3058,14 +4155,94 @@ struct from_deps { };
 struct init { };
 struct with_error { };
 
+// private interface of the injector used by opt-in headers (ex. `boost/di/warm_up.hpp`, `boost/di/async.hpp`)
+struct injector_access {
+    template<class TInjector, class T, class TName = no_name>
+    struct is_creatable : TInjector::template is_creatable<T, TName, std::true_type> { };
+
+    template<class TIsRoot, class TCallPolicies, class TInjector, class T>
+    static auto create(const TInjector& injector, const aux::type<T>& type) {
+        return injector.template create_successful_impl<TIsRoot, TCallPolicies>(type);
+    }
+
+    // objects required by `T` are created by `injector_`
+    template<class TIsRoot, class TCallPolicies, class T, class TName, class TInjector, class TInjector_>
+    static auto create(const TInjector& injector, const TInjector_& injector_) {
+        return injector.template create_successful_impl__<TIsRoot, TCallPolicies, T, TName>(injector_);
+    }
+
+    template<class TSlot, class TInjector>
+    static TSlot& slot(const TInjector& injector) noexcept {
+        return injector.template slot<TSlot>();
+    }
+};
+
+// `injector.create_async<T>(executor)` is implemented by `boost/di/async.hpp`, which might not be included
+template<class... TArgs>
+inline void create_async_injector(const TArgs&...) {
+    static_assert(aux::never<aux::type_list<TArgs...>>::value, "`injector.create_async<T>(executor)` requires `boost/di/async.hpp`");
+}
+
+// `injector.warm_up(...)` is implemented by `boost/di/warm_up.hpp`, which might not be included
+template<class TInjector, class... TArgs>
+inline void warm_up_injector(const TInjector&, const TArgs&...) {
+    static_assert(aux::never<TInjector>::value, "`injector.warm_up(...)` requires `boost/di/warm_up.hpp`");
+}
+
 template<class T, class TInjector>
 inline auto build(const TInjector& injector) noexcept {
     return T{injector};
 }
 
+// instances of scopes keeping them might outlive the child injector, so bindings of the parent
+// with such scopes are created by the parent (see `make_child_injector`)
+template<class TScope, class T>
+struct keeps_instances : std::true_type { };
+
+template<class T>
+struct keeps_instances<scopes::deduce, T> : keeps_instances<type_traits::scope_traits_t<T>, T> { };
+
+template<class T>
+struct keeps_instances<scopes::unique, T> : std::false_type { };
+
+template<class T>
+struct keeps_instances<scopes::external, T> : std::false_type { };
+
+template<class TScope, class T>
+struct keeps_instances<scopes::exposed<TScope>, T> : std::false_type { }; // created by the module
+
+// storage of a binding kept by the injector when its scope defines `slot` (ex. `boost/di/scopes/injector_singleton.hpp`)
+template<class, class = void>
+struct get_slot {
+    using type = aux::type_list<>;
+};
+
+template<class TScope, class TExpected, class TGiven, class TName, class TPriority>
+struct get_slot<
+    dependency<TScope, TExpected, TGiven, TName, TPriority>
+  , typename aux::void_t<typename TScope::template slot<TExpected, TGiven, TName>>::type
+> {
+    using type = aux::type_list<typename TScope::template slot<TExpected, TGiven, TName>>;
+};
+
+// slots are laid out next to each other, slot is found by its binding at compile time
+template<class>
+struct slots;
+
+template<class... TSlots>
+struct slots<aux::type_list<TSlots...>> : TSlots... { };
+
+template<class>
+struct get_slots;
+
+template<class... TDeps>
+struct get_slots<aux::type_list<TDeps...>> {
+    using type = slots<aux::join_t<typename get_slot<TDeps>::type...>>;
+};
+
 template<class T>
-inline decltype(auto) get_arg(const T& arg, const std::false_type&) noexcept {
-    return arg;
+inline T&& get_arg(T&& arg, const std::false_type&) noexcept {
+    return std::forward<T>(arg);
 }
 
 template<class T>
@@ -3077,7 +4254,8 @@ inline decltype(auto) get_arg(const T& arg, const std::true_type&) noexcept {
 #define BOOST_DI_CORE_INJECTOR_POLICY_ELSE(...)
 template<class TConfig BOOST_DI_CORE_INJECTOR_POLICY(, class TPolicies = pool<>)(), class... TDeps>
 class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
-    : pool<transform_t<TDeps...>>
+    : pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>
+    , get_slots<transform_t<TDeps...>>::type
     , public type_traits::config_traits_t<
           TConfig
         , injector<TConfig, BOOST_DI_CORE_INJECTOR_POLICY(TPolicies)(pool<>), TDeps...>
@@ -3088,15 +4266,18 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     template<class> friend class pool;
     template<class> friend class scopes::exposed;
     template<class, class, class> friend struct any_type;
-    template<class, class> friend struct successful::any_type;
+    template<class, class, class> friend struct successful::any_type;
     template<class, class, class> friend struct any_type_ref;
-    template<class, class> friend struct successful::any_type_ref;
+    template<class, class, class> friend struct successful::any_type_ref;
     template<class, class, class, class> friend struct try_provider;
     template<class, class, class, class, class> friend struct provider;
-    template<class, class, class, class> friend struct successful::provider;
+    template<class, class, class, class, class> friend struct successful::provider;
     template<class, class, class> friend struct is_creatable_impl;
+    friend struct injector_access;
+    template<class, class, class...> friend class injector;
 
-    using pool_t = pool<transform_t<TDeps...>>;
+    using pool_t = pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>;
+    using copyable_t = aux::join_t<parents_t<TDeps...>, copyable<transform_t<TDeps...>>>;
     using is_root_t = std::true_type;
     using config_t = type_traits::config_traits_t<TConfig, injector>;
     using config = std::conditional_t<
@@ -3105,20 +4286,29 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
       , config_t
     >;
 
+    template<class T, class TName, class TDependency = binder::resolve_t<injector, T, TName>>
+    using creator_t = std::conditional_t<
+        std::is_reference<TDependency>::value &&
+        keeps_instances<typename std::remove_reference_t<TDependency>::scope, T>::value
+      , binder::owner_t<injector, std::remove_reference_t<TDependency>>
+      , injector
+    >;
+
     template<
         class T
       , class TName = no_name
       , class TIsRoot = std::false_type
-      , class TDependency = std::remove_reference_t<decltype(binder::resolve<T, TName>((injector*)0))>
+      , class TDependency = std::remove_reference_t<binder::resolve_t<injector, T, TName>>
       , class TCtor = typename type_traits::ctor_traits<typename TDependency::given>::type
+      , class TCreator = creator_t<T, TName>
     > static auto try_create_impl() -> std::enable_if_t<std::is_convertible<
        decltype(
            std::declval<TDependency>().template try_create<T>(
                try_provider<
                    typename TDependency::given
                  , TCtor
-                 , injector
-                 , decltype(((TConfig*)0)->provider())
+                 , TCreator
+                 , decltype(std::declval<TCreator&>().provider())
                >{}
            )
        ), T>::value BOOST_DI_CORE_INJECTOR_POLICY(
@@ -3136,6 +4326,10 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     static auto is_creatable_impl(T&&, TName&&, TIsRoot&&)
         -> aux::is_valid_expr<decltype(try_create_impl<T, TName, TIsRoot>())>;
 
+    template<class T, class TThreadSafe, class TName, class TIsRoot>
+    static auto is_creatable_impl(lazy<T, TThreadSafe>&&, TName&&, TIsRoot&&)
+        -> aux::is_valid_expr<decltype(try_create_impl<T, TName>())>;
+
     template<class T, class TName = no_name, class TIsRoot = std::false_type>
     #if defined(BOOST_DI_MSVC)
         struct is_creatable : std::false_type { };
@@ -3168,8 +4362,8 @@ public:
     using deps = transform_t<TDeps...>;
 
     template<class... TArgs>
-    explicit injector(const init&, const TArgs&... args) noexcept
-        : injector{from_deps{}, get_arg(args, has_configure<decltype(args)>{})...}
+    explicit injector(const init&, TArgs&&... args) noexcept
+        : injector{from_deps{}, get_arg(std::forward<TArgs>(args), has_configure<std::decay_t<TArgs>>{})...}
     { }
 
     template<class TConfig_, class TPolicies_, class... TDeps_>
@@ -3188,6 +4382,42 @@ public:
         return create_impl<is_root_t>(aux::type<T>{});
     }
 
+    /**
+     * Creation plan for `T`, resolved and verified (policies constraints included) once
+     * Calling it creates `T` without calling policies, use `create<T>` when they have to be called for every object
+     * Plan holds only a pointer to the injector, so the injector has to outlive it
+     */
+    template<class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, is_root_t>::value)>
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_successful_impl<is_root_t, std::false_type>(aux::type<T>{});
+        };
+    }
+
+    template<class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, is_root_t>::value)>
+    BOOST_DI_CONCEPTS_CREATABLE_ATTR
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_impl<is_root_t>(aux::type<T>{});
+        };
+    }
+
+    /**
+     * Creates `T` asynchronously, requires `boost/di/async.hpp` (see `create_async`)
+     */
+    template<class T, class TExecutor>
+    auto create_async(const TExecutor& executor) const {
+        return create_async_injector(*this, executor, aux::type<T>{});
+    }
+
+    /**
+     * Creates instances of scopes keeping them up front, requires `boost/di/warm_up.hpp` (see `warm_up_injector`)
+     */
+    template<class... TArgs>
+    void warm_up(const TArgs&... args) const {
+        warm_up_injector(*this, args...);
+    }
+
     template<class TAction>
     void call(const TAction& action) {
         call_impl(action, deps{});
@@ -3195,17 +4425,64 @@ public:
 
 private:
     template<class... TArgs>
-    explicit injector(const from_deps&, const TArgs&... args) noexcept
-        : pool_t{copyable<deps>{}, core::pool_t<TArgs...>{args...}}
+    explicit injector(const from_deps&, TArgs&&... args) noexcept
+        : pool_t{copyable_t{}, core::pool_t<std::decay_t<TArgs>...>{std::forward<TArgs>(args)...}}
+        , config{*this}
+    { }
+
+    /**
+     * Module injector is copied once per conversion and shared by all exposed types and copies of this injector
+     */
+    template<class TInjector, class... TArgs>
+    explicit injector(const from_injector&, const TInjector& other, const aux::type_list<TArgs...>& args) noexcept
+        : injector{from_injector{}, std::make_shared<TInjector>(other), args}
+    { }
+
+    template<class TInjector>
+    explicit injector(const from_injector&, const TInjector&, const aux::type_list<>&) noexcept
+        : pool_t{}
         , config{*this}
     { }
 
     template<class TInjector, class... TArgs>
-    explicit injector(const from_injector&, const TInjector& injector, const aux::type_list<TArgs...>&) noexcept
-        : pool_t{copyable<deps>{}, pool_t{build<TArgs>(injector)...}}
+    explicit injector(const from_injector&, const std::shared_ptr<TInjector>& injector, const aux::type_list<TArgs...>&) noexcept
+        : pool_t{copyable_t{}, pool_t{build<TArgs>(injector)...}}
         , config{*this}
     { }
 
+    template<class TSlot>
+    TSlot& slot() const noexcept {
+        return slot<TSlot>((injector*)this);
+    }
+
+    /**
+     * Injector creating objects required by `T`, the parent binding `T` in a scope keeping its instances
+     */
+    template<class T, class TName>
+    const creator_t<T, TName>& creator() const noexcept {
+        return creator<creator_t<T, TName>>((injector*)this);
+    }
+
+    template<class TCreator>
+    static const TCreator& creator(const TCreator* injector) noexcept {
+        return *injector;
+    }
+
+    template<class TCreator, class TInjector, BOOST_DI_REQUIRES(!std::is_same<TCreator, TInjector>::value)>
+    static const TCreator& creator(const TInjector* injector) noexcept {
+        return creator<TCreator>(binder::parent_of(injector));
+    }
+
+    template<class TSlot>
+    static TSlot& slot(TSlot* slot) noexcept {
+        return *slot;
+    }
+
+    template<class TSlot, class TInjector, BOOST_DI_REQUIRES(!std::is_base_of<TSlot, TInjector>::value)>
+    static TSlot& slot(TInjector* injector) noexcept { // binding of the parent
+        return slot<TSlot>(binder::parent_of(injector));
+    }
+
     template<class TIsRoot = std::false_type, class T>
     auto create_impl(const aux::type<T>&) const {
         return create_impl__<TIsRoot, T>();
@@ -3226,61 +4503,129 @@ private:
         return create_impl__<TIsRoot, T, TName>();
     }
 
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe>
+    auto create_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_lazy_impl<T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe, class TName>
+    auto create_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_lazy_impl<T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_successful_lazy_impl<std::true_type, T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(!is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_impl__<std::false_type, T, TName>();
+    }
+
     template<class TIsRoot = std::false_type, class T, class TName = no_name>
     auto create_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, creator_t<T, TName>>;
+        const auto& creator_ = creator<T, TName>();
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{creator_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
         BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+            using arg_t = arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>;
+            const auto& policies = ((TConfig&)*this).policies();
+            policy::template call<arg_t>(policies, dependency, ctor_t{});
+            using keeps_instances_t = keeps_instances<typename dependency_t::scope, T>;
+            policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, dependency_t, keeps_instances_t> guard{policies, dependency};
+            wrapper<create_t, wrapper_t> object{dependency.template create<T>(guard.make_provider(provider_t{creator_}))};
+            guard.created();
+            return object;
+        )(
+            return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{creator_})};
+        )
     }
 
-    template<class TIsRoot = std::false_type, class T>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T>
     auto create_successful_impl(const aux::type<T>&) const {
-        return create_successful_impl__<TIsRoot, T>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T>();
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&) const {
-        return successful::any_type<TParent, injector>{*this};
+        return successful::any_type<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
-        return successful::any_type_ref<TParent, injector>{*this};
+        return successful::any_type_ref<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName>
     auto create_successful_impl(const aux::type<type_traits::named<TName, T>>&) const {
-        return create_successful_impl__<TIsRoot, T, TName>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>();
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName = no_name>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe>
+    auto create_successful_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe, class TName>
+    auto create_successful_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, TName, TThreadSafe>();
+    }
+
+    template<class TCallPolicies, class T, class TName, class TThreadSafe>
+    auto create_successful_lazy_impl() const noexcept {
+        return lazy<T, TThreadSafe>{this, &injector::create_lazy<TCallPolicies, T, TName>};
+    }
+
+    template<class TCallPolicies, class T, class TName>
+    static T create_lazy(const void* injector_) {
+        return static_cast<const injector*>(injector_)->template create_successful_impl__<std::false_type, TCallPolicies, T, TName>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName = no_name>
     auto create_successful_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>(creator<T, TName>());
+    }
+
+    template<class TIsRoot, class TCallPolicies, class T, class TName, class TInjector>
+    auto create_successful_impl__(const TInjector& injector_) const {
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = successful::provider<expected_t, given_t, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = successful::provider<expected_t, given_t, TName, ctor_t, TInjector, TCallPolicies>;
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{injector_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
-        BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return successful::wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+        return create_successful_policies_impl<TIsRoot, T, TName, create_t, wrapper_t, ctor_t>(
+            dependency, provider_t{injector_} BOOST_DI_CORE_INJECTOR_POLICY(, TCallPolicies{})()
+        );
+    }
+
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider BOOST_DI_CORE_INJECTOR_POLICY(, const std::false_type&)()) const {
+        return successful::wrapper<TCreate, TWrapper>{dependency.template create<T>(provider)};
+    }
+
+    BOOST_DI_CORE_INJECTOR_POLICY(
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider, const std::true_type&) const {
+        using arg_t = arg_wrapper<TCreate, TName, TIsRoot, pool_t, std::true_type>;
+        const auto& policies = ((TConfig&)*this).policies();
+        policy::template call<arg_t>(policies, dependency, TCtor{});
+        using keeps_instances_t = keeps_instances<typename TDependency::scope, T>;
+        policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, TDependency, keeps_instances_t> guard{policies, dependency};
+        successful::wrapper<TCreate, TWrapper> object{dependency.template create<T>(guard.make_provider(provider))};
+        guard.created();
+        return object;
     }
+    )()
 
     template<class TAction, class... Ts>
     void call_impl(const TAction& action, const aux::type_list<Ts...>&) {
@@ -3302,7 +4647,8 @@ private:
 #define BOOST_DI_CORE_INJECTOR_POLICY_ELSE(...) __VA_ARGS__
 template<class TConfig BOOST_DI_CORE_INJECTOR_POLICY(, class TPolicies = pool<>)(), class... TDeps>
 class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
-    : pool<transform_t<TDeps...>>
+    : pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>
+    , get_slots<transform_t<TDeps...>>::type
     , public type_traits::config_traits_t<
           TConfig
         , injector<TConfig, BOOST_DI_CORE_INJECTOR_POLICY(TPolicies)(pool<>), TDeps...>
@@ -3313,15 +4659,18 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     template<class> friend class pool;
     template<class> friend class scopes::exposed;
     template<class, class, class> friend struct any_type;
-    template<class, class> friend struct successful::any_type;
+    template<class, class, class> friend struct successful::any_type;
     template<class, class, class> friend struct any_type_ref;
-    template<class, class> friend struct successful::any_type_ref;
+    template<class, class, class> friend struct successful::any_type_ref;
     template<class, class, class, class> friend struct try_provider;
     template<class, class, class, class, class> friend struct provider;
-    template<class, class, class, class> friend struct successful::provider;
+    template<class, class, class, class, class> friend struct successful::provider;
     template<class, class, class> friend struct is_creatable_impl;
+    friend struct injector_access;
+    template<class, class, class...> friend class injector;
 
-    using pool_t = pool<transform_t<TDeps...>>;
+    using pool_t = pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>;
+    using copyable_t = aux::join_t<parents_t<TDeps...>, copyable<transform_t<TDeps...>>>;
     using is_root_t = std::true_type;
     using config_t = type_traits::config_traits_t<TConfig, injector>;
     using config = std::conditional_t<
@@ -3330,20 +4679,29 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
       , config_t
     >;
 
+    template<class T, class TName, class TDependency = binder::resolve_t<injector, T, TName>>
+    using creator_t = std::conditional_t<
+        std::is_reference<TDependency>::value &&
+        keeps_instances<typename std::remove_reference_t<TDependency>::scope, T>::value
+      , binder::owner_t<injector, std::remove_reference_t<TDependency>>
+      , injector
+    >;
+
     template<
         class T
       , class TName = no_name
       , class TIsRoot = std::false_type
-      , class TDependency = std::remove_reference_t<decltype(binder::resolve<T, TName>((injector*)0))>
+      , class TDependency = std::remove_reference_t<binder::resolve_t<injector, T, TName>>
       , class TCtor = typename type_traits::ctor_traits<typename TDependency::given>::type
+      , class TCreator = creator_t<T, TName>
     > static auto try_create_impl() -> std::enable_if_t<std::is_convertible<
        decltype(
            std::declval<TDependency>().template try_create<T>(
                try_provider<
                    typename TDependency::given
                  , TCtor
-                 , injector
-                 , decltype(((TConfig*)0)->provider())
+                 , TCreator
+                 , decltype(std::declval<TCreator&>().provider())
                >{}
            )
        ), T>::value BOOST_DI_CORE_INJECTOR_POLICY(
@@ -3361,6 +4719,10 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     static auto is_creatable_impl(T&&, TName&&, TIsRoot&&)
         -> aux::is_valid_expr<decltype(try_create_impl<T, TName, TIsRoot>())>;
 
+    template<class T, class TThreadSafe, class TName, class TIsRoot>
+    static auto is_creatable_impl(lazy<T, TThreadSafe>&&, TName&&, TIsRoot&&)
+        -> aux::is_valid_expr<decltype(try_create_impl<T, TName>())>;
+
     template<class T, class TName = no_name, class TIsRoot = std::false_type>
     #if defined(BOOST_DI_MSVC)
         struct is_creatable : std::false_type { };
@@ -3393,8 +4755,8 @@ public:
     using deps = transform_t<TDeps...>;
 
     template<class... TArgs>
-    explicit injector(const init&, const TArgs&... args) noexcept
-        : injector{from_deps{}, get_arg(args, has_configure<decltype(args)>{})...}
+    explicit injector(const init&, TArgs&&... args) noexcept
+        : injector{from_deps{}, get_arg(std::forward<TArgs>(args), has_configure<std::decay_t<TArgs>>{})...}
     { }
 
     template<class TConfig_, class TPolicies_, class... TDeps_>
@@ -3413,6 +4775,42 @@ public:
         return create_impl<is_root_t>(aux::type<T>{});
     }
 
+    /**
+     * Creation plan for `T`, resolved and verified (policies constraints included) once
+     * Calling it creates `T` without calling policies, use `create<T>` when they have to be called for every object
+     * Plan holds only a pointer to the injector, so the injector has to outlive it
+     */
+    template<class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, is_root_t>::value)>
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_successful_impl<is_root_t, std::false_type>(aux::type<T>{});
+        };
+    }
+
+    template<class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, is_root_t>::value)>
+    BOOST_DI_CONCEPTS_CREATABLE_ATTR
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_impl<is_root_t>(aux::type<T>{});
+        };
+    }
+
+    /**
+     * Creates `T` asynchronously, requires `boost/di/async.hpp` (see `create_async`)
+     */
+    template<class T, class TExecutor>
+    auto create_async(const TExecutor& executor) const {
+        return create_async_injector(*this, executor, aux::type<T>{});
+    }
+
+    /**
+     * Creates instances of scopes keeping them up front, requires `boost/di/warm_up.hpp` (see `warm_up_injector`)
+     */
+    template<class... TArgs>
+    void warm_up(const TArgs&... args) const {
+        warm_up_injector(*this, args...);
+    }
+
     template<class TAction>
     void call(const TAction& action) {
         call_impl(action, deps{});
@@ -3420,17 +4818,64 @@ public:
 
 private:
     template<class... TArgs>
-    explicit injector(const from_deps&, const TArgs&... args) noexcept
-        : pool_t{copyable<deps>{}, core::pool_t<TArgs...>{args...}}
+    explicit injector(const from_deps&, TArgs&&... args) noexcept
+        : pool_t{copyable_t{}, core::pool_t<std::decay_t<TArgs>...>{std::forward<TArgs>(args)...}}
+        , config{*this}
+    { }
+
+    /**
+     * Module injector is copied once per conversion and shared by all exposed types and copies of this injector
+     */
+    template<class TInjector, class... TArgs>
+    explicit injector(const from_injector&, const TInjector& other, const aux::type_list<TArgs...>& args) noexcept
+        : injector{from_injector{}, std::make_shared<TInjector>(other), args}
+    { }
+
+    template<class TInjector>
+    explicit injector(const from_injector&, const TInjector&, const aux::type_list<>&) noexcept
+        : pool_t{}
         , config{*this}
     { }
 
     template<class TInjector, class... TArgs>
-    explicit injector(const from_injector&, const TInjector& injector, const aux::type_list<TArgs...>&) noexcept
-        : pool_t{copyable<deps>{}, pool_t{build<TArgs>(injector)...}}
+    explicit injector(const from_injector&, const std::shared_ptr<TInjector>& injector, const aux::type_list<TArgs...>&) noexcept
+        : pool_t{copyable_t{}, pool_t{build<TArgs>(injector)...}}
         , config{*this}
     { }
 
+    template<class TSlot>
+    TSlot& slot() const noexcept {
+        return slot<TSlot>((injector*)this);
+    }
+
+    /**
+     * Injector creating objects required by `T`, the parent binding `T` in a scope keeping its instances
+     */
+    template<class T, class TName>
+    const creator_t<T, TName>& creator() const noexcept {
+        return creator<creator_t<T, TName>>((injector*)this);
+    }
+
+    template<class TCreator>
+    static const TCreator& creator(const TCreator* injector) noexcept {
+        return *injector;
+    }
+
+    template<class TCreator, class TInjector, BOOST_DI_REQUIRES(!std::is_same<TCreator, TInjector>::value)>
+    static const TCreator& creator(const TInjector* injector) noexcept {
+        return creator<TCreator>(binder::parent_of(injector));
+    }
+
+    template<class TSlot>
+    static TSlot& slot(TSlot* slot) noexcept {
+        return *slot;
+    }
+
+    template<class TSlot, class TInjector, BOOST_DI_REQUIRES(!std::is_base_of<TSlot, TInjector>::value)>
+    static TSlot& slot(TInjector* injector) noexcept { // binding of the parent
+        return slot<TSlot>(binder::parent_of(injector));
+    }
+
     template<class TIsRoot = std::false_type, class T>
     auto create_impl(const aux::type<T>&) const {
         return create_impl__<TIsRoot, T>();
@@ -3451,62 +4896,130 @@ private:
         return create_impl__<TIsRoot, T, TName>();
     }
 
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe>
+    auto create_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_lazy_impl<T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe, class TName>
+    auto create_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_lazy_impl<T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_successful_lazy_impl<std::true_type, T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(!is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_impl__<std::false_type, T, TName>();
+    }
+
     template<class TIsRoot = std::false_type, class T, class TName = no_name>
     auto create_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, creator_t<T, TName>>;
+        const auto& creator_ = creator<T, TName>();
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{creator_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
         BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+            using arg_t = arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>;
+            const auto& policies = ((TConfig&)*this).policies();
+            policy::template call<arg_t>(policies, dependency, ctor_t{});
+            using keeps_instances_t = keeps_instances<typename dependency_t::scope, T>;
+            policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, dependency_t, keeps_instances_t> guard{policies, dependency};
+            wrapper<create_t, wrapper_t> object{dependency.template create<T>(guard.make_provider(provider_t{creator_}))};
+            guard.created();
+            return object;
+        )(
+            return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{creator_})};
+        )
     }
 
-    template<class TIsRoot = std::false_type, class T>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T>
     auto create_successful_impl(const aux::type<T>&) const {
-        return create_successful_impl__<TIsRoot, T>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T>();
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&) const {
-        return successful::any_type<TParent, injector>{*this};
+        return successful::any_type<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
-        return successful::any_type_ref<TParent, injector>{*this};
+        return successful::any_type_ref<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName>
     auto create_successful_impl(const aux::type<type_traits::named<TName, T>>&) const {
-        return create_successful_impl__<TIsRoot, T, TName>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>();
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName = no_name>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe>
+    auto create_successful_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe, class TName>
+    auto create_successful_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, TName, TThreadSafe>();
+    }
+
+    template<class TCallPolicies, class T, class TName, class TThreadSafe>
+    auto create_successful_lazy_impl() const noexcept {
+        return lazy<T, TThreadSafe>{this, &injector::create_lazy<TCallPolicies, T, TName>};
+    }
+
+    template<class TCallPolicies, class T, class TName>
+    static T create_lazy(const void* injector_) {
+        return static_cast<const injector*>(injector_)->template create_successful_impl__<std::false_type, TCallPolicies, T, TName>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName = no_name>
     auto create_successful_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>(creator<T, TName>());
+    }
+
+    template<class TIsRoot, class TCallPolicies, class T, class TName, class TInjector>
+    auto create_successful_impl__(const TInjector& injector_) const {
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = successful::provider<expected_t, given_t, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = successful::provider<expected_t, given_t, TName, ctor_t, TInjector, TCallPolicies>;
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{injector_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
-        BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return successful::wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+        return create_successful_policies_impl<TIsRoot, T, TName, create_t, wrapper_t, ctor_t>(
+            dependency, provider_t{injector_} BOOST_DI_CORE_INJECTOR_POLICY(, TCallPolicies{})()
+        );
+    }
+
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider BOOST_DI_CORE_INJECTOR_POLICY(, const std::false_type&)()) const {
+        return successful::wrapper<TCreate, TWrapper>{dependency.template create<T>(provider)};
     }
 
+    BOOST_DI_CORE_INJECTOR_POLICY(
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider, const std::true_type&) const {
+        using arg_t = arg_wrapper<TCreate, TName, TIsRoot, pool_t, std::true_type>;
+        const auto& policies = ((TConfig&)*this).policies();
+        policy::template call<arg_t>(policies, dependency, TCtor{});
+        using keeps_instances_t = keeps_instances<typename TDependency::scope, T>;
+        policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, TDependency, keeps_instances_t> guard{policies, dependency};
+        successful::wrapper<TCreate, TWrapper> object{dependency.template create<T>(guard.make_provider(provider))};
+        guard.created();
+        return object;
+    }
+    )()
+
     template<class TAction, class... Ts>
     void call_impl(const TAction& action, const aux::type_list<Ts...>&) {
         int _[]{0, (call_impl<Ts>(action, has_call<Ts, const TAction&>{}), 0)...}; (void)_;
@@ -3661,7 +5174,7 @@ public:
                     std::integral_constant<bool,
                         core::is_creatable_impl<
                             T
-                          , core::injector<TConfig, decltype(((TConfig*)0)->policies()), TDeps...>
+                          , core::injector<TConfig, decltype(std::declval<TConfig&>().policies()), TDeps...>
                           , typename std::is_same<concepts::configurable<TConfig>, std::true_type>::type
                         >::value
                     >{}
@@ -3683,12 +5196,34 @@ namespace boost { namespace di { inline namespace v1 {
 template<
      class TConfig = ::BOOST_DI_CFG
    , class... TDeps
-   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<TDeps...>>)
+   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<std::decay_t<TDeps>...>>)
+   , BOOST_DI_REQUIRES_MSG(concepts::configurable<TConfig>)
+> inline auto make_injector(TDeps&&... args) noexcept {
+    return core::injector<TConfig, decltype(std::declval<TConfig&>().policies()), std::decay_t<TDeps>...>{
+        core::init{}, std::forward<TDeps>(args)...
+    };
+}
+
+// injector layering `args` over `parent`, which is referenced (not copied) and has to outlive it
+// types bound by `args` are created by the child, other types by bindings of the parent (instances kept by scopes
+// of the parent are shared), constructor parameters are resolved by the child unless the binding of the parent keeps
+// its instances (ex. `shared`, `singleton`), such instances are created by the parent as they outlive the child
+template<
+     class TConfig = ::BOOST_DI_CFG
+   , class TParent
+   , class... TDeps
+   , BOOST_DI_REQUIRES(core::is_injector<TParent>::value)
+   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<std::decay_t<TDeps>...>>)
    , BOOST_DI_REQUIRES_MSG(concepts::configurable<TConfig>)
-> inline auto make_injector(const TDeps&... args) noexcept {
-    return core::injector<TConfig, decltype(((TConfig*)0)->policies()), TDeps...>{core::init{}, args...};
+> inline auto make_child_injector(const TParent& parent, TDeps&&... args) noexcept {
+    return core::injector<TConfig, decltype(std::declval<TConfig&>().policies()), core::parent<TParent>, std::decay_t<TDeps>...>{
+        core::init{}, core::parent<TParent>{parent}, std::forward<TDeps>(args)...
+    };
 }
 
+template<class TConfig = ::BOOST_DI_CFG, class TParent, class... TDeps>
+void make_child_injector(const TParent&&, TDeps&&...) = delete; // parent has to outlive the child
+
 }}} // boost::di::v1
 
 #endif
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_ALLOCATIONS_HPP
+#define BOOST_DI_ALLOCATIONS_HPP
+
+#include <memory>
+#include <type_traits>
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/core/any_type.hpp"
+#include "boost/di/core/binder.hpp"
+#include "boost/di/core/dependency.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/core/wrapper.hpp"
+#include "boost/di/lazy.hpp"
+#include "boost/di/scopes/deduce.hpp"
+#include "boost/di/scopes/exposed.hpp"
+#include "boost/di/scopes/external.hpp"
+#include "boost/di/scopes/unique.hpp"
+#include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/type_traits/scope_traits.hpp"
+#include "boost/di/wrappers/unique.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace core {
+
+template<class... Ts>
+constexpr std::size_t allocations_sum(Ts... allocations) noexcept {
+    std::size_t result = 0;
+    int _[]{0, (result += allocations, 0)...}; (void)_;
+    return result;
+}
+
+// `value` allocations, `known` tells whether all of them were counted
+template<std::size_t Value, bool Known = true>
+struct allocations_result {
+    static constexpr auto value = Value;
+    static constexpr auto known = Known;
+};
+
+template<class... Ts>
+struct allocations_join : allocations_result<
+    allocations_sum(std::size_t{0}, Ts::value...)
+  , std::is_same<aux::bool_list<aux::always<Ts>::value...>, aux::bool_list<Ts::known...>>::value
+> { };
+
+// `new` of the given type, shared pointers allocate their reference counter as well
+template<class>
+struct heap_allocations : std::integral_constant<std::size_t, 1> { };
+
+template<class T>
+struct heap_allocations<std::shared_ptr<T>> : std::integral_constant<std::size_t, 2> { };
+
+template<class T>
+struct heap_allocations<std::weak_ptr<T>> : std::integral_constant<std::size_t, 2> { };
+
+template<class T>
+struct heap_allocations<boost::shared_ptr<T>> : std::integral_constant<std::size_t, 2> { };
+
+template<class T>
+struct heap_allocations<local_shared_ptr<T>> : std::integral_constant<std::size_t, 2> { };
+
+// object returned by the provider, raw and unique pointers with the default deleter are allocated by `new`,
+// pointers with other deleters are allocated by the provider (ex. `providers::arena`)
+template<class>
+struct provided_allocations : std::integral_constant<std::size_t, 0> { };
+
+template<class T>
+struct provided_allocations<T*> : std::integral_constant<std::size_t, 1> { };
+
+template<class T>
+struct provided_allocations<std::unique_ptr<T>> : std::integral_constant<std::size_t, 1> { };
+
+template<class T>
+struct provided_allocations<std::shared_ptr<T>> : std::integral_constant<std::size_t, 1> { };
+
+// requested type made out of the pointer returned by the provider, ex. reference counter of `std::shared_ptr`
+template<class T, class>
+struct wrapped_allocations : std::integral_constant<std::size_t, 0> { };
+
+template<class T, class TProvided>
+struct wrapped_allocations<T, TProvided*> : std::integral_constant<std::size_t, heap_allocations<std::decay_t<T>>::value - 1> { };
+
+template<class T, class TProvided, class TDeleter>
+struct wrapped_allocations<T, std::unique_ptr<TProvided, TDeleter>> : wrapped_allocations<T, TProvided*> { };
+
+template<class>
+struct provided {
+    using type = aux::none_type;
+};
+
+template<class T, class TWrapper>
+struct provided<successful::wrapper<T, TWrapper>> : provided<TWrapper> { };
+
+template<class T>
+struct provided<wrappers::unique<T>> {
+    using type = T;
+};
+
+template<class TInjector, class T, class TName = no_name>
+struct allocations;
+
+template<class TInjector, class TParent, class T>
+struct arg_allocations : allocations<TInjector, T> { };
+
+template<class TInjector, class TParent, class T, class TName>
+struct arg_allocations<TInjector, TParent, type_traits::named<TName, T>> : allocations<TInjector, T, TName> { };
+
+// parameters of deduced constructors are known when they are created
+template<class TInjector, class TParent, class TParent_>
+struct arg_allocations<TInjector, TParent, any_type_fwd<TParent_>> : allocations_result<0, false> { };
+
+template<class TInjector, class TParent, class TParent_>
+struct arg_allocations<TInjector, TParent, any_type_ref_fwd<TParent_>> : allocations_result<0, false> { };
+
+template<class TInjector, class T, class>
+struct ctor_allocations;
+
+template<class TInjector, class T, class TInitialization, class... TCtor>
+struct ctor_allocations<TInjector, T, aux::pair<TInitialization, aux::type_list<TCtor...>>>
+    : allocations_join<arg_allocations<TInjector, T, TCtor>...>
+{ };
+
+// scopes keeping instances allocate them once, the instance is assumed to be created already (see `injector::warm_up`)
+template<class TInjector, class T, class TName, class TDependency, class TScope>
+struct scope_allocations : allocations_result<0> { };
+
+template<class TInjector, class T, class TName, class TDependency>
+struct scope_allocations<TInjector, T, TName, TDependency, scopes::deduce>
+    : scope_allocations<TInjector, T, TName, TDependency, type_traits::scope_traits_t<T>>
+{ };
+
+template<class TInjector, class T, class TName, class TDependency>
+struct scope_allocations<TInjector, T, TName, TDependency, scopes::external> : allocations_result<0> { };
+
+// counted through the object returned by the provider of the injector
+template<class TInjector, class T, class TName, class TDependency>
+struct scope_allocations<TInjector, T, TName, TDependency, scopes::unique> {
+    using provided_t = typename provided<decltype(
+        injector_access::create<std::false_type, std::false_type, T, TName>(std::declval<const TInjector&>(), std::declval<const TInjector&>())
+    )>::type;
+    using ctor_t = ctor_allocations<TInjector, typename TDependency::given, typename type_traits::ctor_traits<typename TDependency::given>::type>;
+
+    static constexpr auto value = allocations_sum(
+        provided_allocations<provided_t>::value, wrapped_allocations<T, provided_t>::value, ctor_t::value
+    );
+    static constexpr auto known = ctor_t::known;
+};
+
+// created by the module injector, which type is erased unless the module was bound directly
+template<class TInjector, class T, class TDependency, class TScope, class = typename has_deps<typename TDependency::given>::type>
+struct exposed_allocations : allocations_result<0, false> { };
+
+template<class TInjector, class T, class TDependency, class TScope>
+struct exposed_allocations<TInjector, T, TDependency, TScope, std::true_type> : allocations_result<0> { };
+
+template<class TInjector, class T, class TDependency>
+struct exposed_allocations<TInjector, T, TDependency, scopes::deduce, std::true_type>
+    : exposed_allocations<TInjector, T, TDependency, type_traits::scope_traits_t<T>, std::true_type>
+{ };
+
+template<class TInjector, class T, class TDependency>
+struct exposed_allocations<TInjector, T, TDependency, scopes::unique, std::true_type>
+    : allocations_join<
+          allocations<typename TDependency::given, typename TDependency::expected*>
+        , allocations_result<wrapped_allocations<T, typename TDependency::expected*>::value>
+      >
+{ };
+
+template<class TInjector, class T, class TName, class TDependency, class TScope>
+struct scope_allocations<TInjector, T, TName, TDependency, scopes::exposed<TScope>>
+    : exposed_allocations<TInjector, T, TDependency, TScope>
+{ };
+
+// `T` is created on the first use, not by `create`
+template<class TInjector, class T, class TThreadSafe, class TName>
+struct allocations<TInjector, lazy<T, TThreadSafe>, TName> : allocations_result<0> { };
+
+template<class TInjector, class T, class TName>
+struct allocations : scope_allocations<
+    TInjector
+  , T
+  , TName
+  , std::remove_reference_t<binder::resolve_t<TInjector, T, TName>>
+  , typename std::remove_reference_t<binder::resolve_t<TInjector, T, TName>>::scope
+> { };
+
+} // core
+
+/**
+ * Heap allocations made by `injector.create<T>()` (without allocations made by constructors themselves), computed from
+ * scopes of the object graph and objects returned by the provider of the injector. Instances of scopes keeping them (ex. `singleton`)
+ * are assumed to be created already. Parameters of deduced constructors and types exposed by type erased injectors aren't counted
+ */
+template<class TInjector, class T>
+constexpr std::size_t allocations_for() noexcept {
+    return core::allocations<TInjector, T>::value;
+}
+
+/**
+ * Whether `allocations_for<TInjector, T>()` counted all allocations, constructor parameters have to be known
+ * (`BOOST_DI_INJECT`, `ctor_traits`) and exposed types have to be bound to injectors of known type
+ */
+template<class TInjector, class T>
+constexpr bool allocations_known() noexcept {
+    return core::allocations<TInjector, T>::known;
+}
+
+}}} // boost::di::v1
+
+#endif
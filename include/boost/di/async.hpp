@@ -0,0 +1,283 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_ASYNC_HPP
+#define BOOST_DI_ASYNC_HPP
+
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/core/any_type.hpp"
+#include "boost/di/core/binder.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/lazy.hpp"
+#include "boost/di/scopes/deduce.hpp"
+#include "boost/di/scopes/external.hpp"
+#include "boost/di/scopes/session.hpp"
+#include "boost/di/scopes/shared.hpp"
+#include "boost/di/scopes/singleton.hpp"
+#include "boost/di/scopes/unique.hpp"
+#include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/scope_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace core {
+
+template<class>
+struct is_any_type_fwd : std::false_type { };
+
+template<class TParent>
+struct is_any_type_fwd<any_type_fwd<TParent>> : std::true_type { };
+
+template<class TParent>
+struct is_any_type_fwd<any_type_ref_fwd<TParent>> : std::true_type { };
+
+// constructor arguments are created concurrently when they are known (ex. BOOST_DI_INJECT) and each of them is different
+template<class>
+struct is_async_ctor : std::false_type { };
+
+template<class TInitialization, class... TCtor>
+struct is_async_ctor<aux::pair<TInitialization, aux::type_list<TCtor...>>>
+    : std::integral_constant<bool,
+          (sizeof...(TCtor) > 1) && aux::is_unique<TCtor...>::value &&
+          std::is_same<aux::bool_list<aux::never<TCtor>::value...>, aux::bool_list<is_any_type_fwd<TCtor>::value...>>::value
+      >
+{ };
+
+// scopes which might be asked for their instance by many threads at the same time
+template<class>
+struct is_async_scope : std::false_type { };
+
+template<>
+struct is_async_scope<scopes::unique> : std::true_type { };
+
+template<>
+struct is_async_scope<scopes::shared_mt> : std::true_type { };
+
+template<>
+struct is_async_scope<scopes::singleton> : std::true_type { };
+
+template<>
+struct is_async_scope<scopes::injector_singleton> : std::true_type { };
+
+template<>
+struct is_async_scope<scopes::reloadable> : std::true_type { };
+
+template<class TName>
+struct is_async_scope<scopes::session_mt<TName>> : std::true_type { };
+
+template<class TReset, std::size_t Capacity, std::size_t ThreadCapacity>
+struct is_async_scope<scopes::pooled<TReset, Capacity, ThreadCapacity>> : std::true_type { };
+
+template<class TDeps, class T, class TName = no_name>
+struct is_async_safe;
+
+template<class TDeps, class T, class TCtor>
+struct is_async_safe_ctor : std::false_type { }; // parameters aren't known
+
+template<class TDeps, class T, class TInitialization, class... TCtor>
+struct is_async_safe_ctor<TDeps, T, aux::pair<TInitialization, aux::type_list<TCtor...>>>
+    : std::is_same<aux::bool_list<aux::always<TCtor>::value...>, aux::bool_list<is_async_safe<TDeps, TCtor>::value...>>
+{ };
+
+template<class TDeps, class T, class TDependency, class TScope>
+struct is_async_safe_scope
+    : std::integral_constant<bool, is_async_scope<TScope>::value && is_async_safe_ctor<
+          TDeps, typename TDependency::given, typename type_traits::ctor_traits<typename TDependency::given>::type
+      >::value>
+{ };
+
+template<class TDeps, class T, class TDependency>
+struct is_async_safe_scope<TDeps, T, TDependency, scopes::deduce>
+    : is_async_safe_scope<TDeps, T, TDependency, type_traits::scope_traits_t<T>>
+{ };
+
+template<class>
+struct is_async_shared : std::false_type { };
+
+template<class T>
+struct is_async_shared<std::shared_ptr<T>> : std::true_type { };
+
+// values are handed out, callables might create anything
+template<class TDeps, class T, class TDependency>
+struct is_async_safe_scope<TDeps, T, TDependency, scopes::external>
+    : std::integral_constant<bool,
+          std::is_same<typename TDependency::expected, std::remove_reference_t<typename TDependency::given>>::value ||
+          std::is_base_of<typename TDependency::expected, std::remove_reference_t<typename TDependency::given>>::value ||
+          is_async_shared<typename TDependency::given>::value
+      >
+{ };
+
+// whether `T` might be created whilst other objects are created by other threads,
+// object graph of `T` has to be known and consist of scopes which are safe to be used concurrently only
+template<class TDeps, class T, class TName>
+struct is_async_safe {
+    using dependency = std::remove_reference_t<binder::resolve_t<TDeps, T, TName>>;
+    static constexpr auto value = is_async_safe_scope<TDeps, T, dependency, typename dependency::scope>::value;
+};
+
+template<class TDeps, class T, class TName, class TName_>
+struct is_async_safe<TDeps, type_traits::named<TName, T>, TName_> : is_async_safe<TDeps, T, TName> { };
+
+template<class TDeps, class T, class TThreadSafe, class TName>
+struct is_async_safe<TDeps, lazy<T, TThreadSafe>, TName> : std::true_type { }; // created on the first use
+
+template<class TDeps, class TParent, class TName>
+struct is_async_safe<TDeps, any_type_fwd<TParent>, TName> : std::false_type { };
+
+template<class TDeps, class TParent, class TName>
+struct is_async_safe<TDeps, any_type_ref_fwd<TParent>, TName> : std::false_type { };
+
+template<class TCtor, class TWrapper>
+struct async_arg {
+    std::unique_ptr<TWrapper> object;
+    std::exception_ptr error;
+};
+
+template<class TCtor, class TWrapper>
+inline auto& async_get(async_arg<TCtor, TWrapper>& arg) noexcept {
+    return arg;
+}
+
+template<class T, class... TArgs>
+struct async_state : TArgs... {
+    std::exception_ptr error() const noexcept {
+        std::exception_ptr result;
+        int _[]{0, (result = result ? result : static_cast<const TArgs&>(*this).error, 0)...}; (void)_;
+        return result;
+    }
+
+    std::promise<T> promise;
+    std::atomic<std::size_t> pending{sizeof...(TArgs)};
+};
+
+// injector seen by the provider of the created object, constructor arguments are taken from the state
+template<class TInjector, class TState>
+struct async_injector {
+    auto provider() const noexcept {
+        return injector_.provider();
+    }
+
+    template<class T>
+    T create() const {
+        return injector_.template create<T>();
+    }
+
+    template<class, class, class T>
+    auto& create_successful_impl(const aux::type<T>&) const noexcept {
+        return *async_get<T>(state_).object;
+    }
+
+    template<class TSlot>
+    TSlot& slot() const noexcept {
+        return injector_access::slot<TSlot>(injector_);
+    }
+
+    const TInjector& injector_;
+    TState& state_;
+};
+
+template<class T, class TInjector, class TExecutor, class TCtor>
+inline std::future<T> create_async_impl(const TInjector& injector, const TExecutor& executor, const TCtor&, const std::false_type&) {
+    auto promise = std::make_shared<std::promise<T>>();
+    auto future = promise->get_future();
+    executor([&injector, promise] {
+        try {
+            promise->set_value(static_cast<T>(injector_access::create<std::true_type, std::true_type>(injector, aux::type<T>{})));
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
+template<class T, class TCtor, class TInjector, class TState>
+inline void create_async_arg(const TInjector& injector, TState& state) {
+    auto& arg = async_get<TCtor>(state);
+    using wrapper_t = typename std::remove_reference_t<decltype(arg.object)>::element_type;
+    try {
+        arg.object = std::make_unique<wrapper_t>(injector_access::create<std::false_type, std::true_type>(injector, aux::type<TCtor>{}));
+    } catch (...) {
+        arg.error = std::current_exception();
+    }
+
+    if (state.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) { // the last one creates `T`
+        if (auto error = state.error()) {
+            state.promise.set_exception(error);
+            return;
+        }
+
+        try {
+            state.promise.set_value(static_cast<T>(
+                injector_access::create<std::true_type, std::true_type, T, no_name>(injector, async_injector<TInjector, TState>{injector, state})
+            ));
+        } catch (...) {
+            state.promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+template<class T, class TInjector, class TExecutor, class TInitialization, class... TCtor>
+inline std::future<T> create_async_impl(const TInjector& injector, const TExecutor& executor
+                                      , const aux::pair<TInitialization, aux::type_list<TCtor...>>&, const std::true_type&) {
+    using state_t = async_state<T, async_arg<TCtor, decltype(injector_access::create<std::false_type, std::true_type>(injector, aux::type<TCtor>{}))>...>;
+    auto state = std::make_shared<state_t>();
+    auto future = state->promise.get_future();
+    int _[]{0, (executor([&injector, state] { create_async_arg<T, TCtor>(injector, *state); }), 0)...}; (void)_;
+    return future;
+}
+
+} // core
+
+/**
+ * Creates `T` asynchronously, `executor(task)` is called with a copyable task for each argument of `T` constructor
+ * Arguments are created concurrently when they are known (`BOOST_DI_INJECT`, `ctor_traits`), each of them is different
+ * and their object graphs consist of known constructors and scopes safe to be used concurrently (ex. `unique`, `shared_mt`,
+ * `singleton`, values), `T` is created by the task which finished as the last one, otherwise `T` is created by a single task
+ * Exception thrown by any of the tasks is stored in the returned future, tasks don't throw
+ * Throws whatever `executor` throws (ex. `std::system_error` when it can't start a thread) and `std::bad_alloc` when the shared state
+ * can't be allocated, tasks already passed to `executor` still run, but the future is not returned
+ * Injector has to outlive the returned future
+ */
+template<class T, class TConfig, class TPolicies, class... TDeps, class TExecutor,
+         BOOST_DI_REQUIRES(core::injector_access::is_creatable<core::injector<TConfig, TPolicies, TDeps...>, T>::value)>
+inline std::future<T> create_async(const core::injector<TConfig, TPolicies, TDeps...>& injector, const TExecutor& executor) {
+    using injector_t = core::injector<TConfig, TPolicies, TDeps...>;
+    using dependency_t = std::remove_reference_t<core::binder::resolve_t<injector_t, T>>;
+    using ctor_t = typename type_traits::ctor_traits<typename dependency_t::given>::type;
+    using is_async_t = std::integral_constant<bool,
+        core::is_async_ctor<ctor_t>::value && core::is_async_safe_ctor<injector_t, typename dependency_t::given, ctor_t>::value
+    >;
+    return core::create_async_impl<T>(injector, executor, ctor_t{}, is_async_t{});
+}
+
+// `injector.create<T>()` reports why `T` can't be created
+template<class T, class TConfig, class TPolicies, class... TDeps, class TExecutor,
+         BOOST_DI_REQUIRES(!core::injector_access::is_creatable<core::injector<TConfig, TPolicies, TDeps...>, T>::value)>
+inline std::future<T> create_async(const core::injector<TConfig, TPolicies, TDeps...>& injector, const TExecutor&) {
+    std::promise<T> promise;
+    promise.set_value(injector.template create<T>());
+    return promise.get_future();
+}
+
+namespace core {
+
+// `injector.create_async<T>(executor)`
+template<class T, class TConfig, class TPolicies, class... TDeps, class TExecutor>
+inline std::future<T> create_async_injector(const injector<TConfig, TPolicies, TDeps...>& injector_, const TExecutor& executor, const aux::type<T>&) {
+    return di::create_async<T>(injector_, executor);
+}
+
+} // core
+
+}}} // boost::di::v1
+
+#endif
+
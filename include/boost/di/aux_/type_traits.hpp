@@ -89,6 +89,11 @@ struct is_smart_ptr<std::weak_ptr<T>>
     : std::true_type
 { };
 
+template<class T>
+struct is_smart_ptr<local_shared_ptr<T>>
+    : std::true_type
+{ };
+
 template<class T, class... TArgs>
 decltype(void(T{std::declval<TArgs>()...}), std::true_type{})
 test_is_braces_constructible(int);
@@ -45,6 +45,7 @@ constexpr core::override override{};
 constexpr scopes::deduce deduce{};
 constexpr scopes::unique unique{};
 constexpr scopes::shared shared{};
+constexpr scopes::shared_mt shared_mt{};
 constexpr scopes::singleton singleton{};
 
 template<class TName>
@@ -52,6 +53,11 @@ constexpr auto session(const TName&) noexcept {
     return scopes::session<TName>{};
 }
 
+template<class TName>
+constexpr auto session_mt(const TName&) noexcept {
+    return scopes::session_mt<TName>{};
+}
+
 template<class TName>
 constexpr auto session_entry(const TName&) noexcept {
     return scopes::session_entry<TName>{};
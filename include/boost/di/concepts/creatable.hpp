@@ -225,7 +225,7 @@ template<class T>
 using ctor_size_t = ctor_size<
     typename type_traits::ctor<
         aux::decay_t<T>
-      , type_traits::ctor_impl_t<std::is_constructible, aux::decay_t<T>>
+      , type_traits::ctor_impl_t<type_traits::direct, aux::decay_t<T>>
     >::type
 >;
 
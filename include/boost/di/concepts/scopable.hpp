@@ -9,6 +9,7 @@
 
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/local_shared_ptr.hpp"
 #include "boost/di/type_traits/ctor_traits.hpp"
 #include "boost/di/type_traits/memory_traits.hpp"
 
@@ -24,6 +25,10 @@ struct provider {
     T* get(const TMemory& = {}) const {
         return nullptr;
     }
+
+    local_shared_ptr<T> get(const type_traits::local_shared_heap&) const {
+        return nullptr;
+    }
 };
 
 std::false_type scopable_impl(...);
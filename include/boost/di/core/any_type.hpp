@@ -20,7 +20,7 @@ using is_not_same = std::enable_if_t<!aux::is_same_or_base_of<T, TParent>::value
 template<class T, class TInjector>
 struct is_referable_impl {
     static constexpr auto value =
-        std::remove_reference_t<decltype(binder::resolve<T>((TInjector*)nullptr))>::template
+        std::remove_reference_t<binder::resolve_t<TInjector, T>>::template
             is_referable<T>::value;
 };
 
@@ -55,6 +55,14 @@ struct any_type {
         return injector_.create_impl(aux::type<T>{});
     }
 
+    template<class T
+           , class = is_not_same<T, TParent>
+           , class = is_referable<const std::shared_ptr<T>&, TInjector>
+           , class = is_creatable<const std::shared_ptr<T>&, TInjector, TError>
+    > operator const std::shared_ptr<T>&() const { // kept instance is passed without copying it
+        return injector_.create_impl(aux::type<const std::shared_ptr<T>&>{});
+    }
+
     const TInjector& injector_;
 };
 
@@ -98,21 +106,28 @@ struct any_type_ref {
 
 namespace successful {
 
-template<class TParent, class TInjector>
+template<class TParent, class TInjector, class TCallPolicies = std::true_type>
 struct any_type {
     template<class T, class = is_not_same<T, TParent>>
     operator T() {
-        return injector_.create_successful_impl(aux::type<T>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T>{});
+    }
+
+    template<class T
+           , class = is_not_same<T, TParent>
+           , class = is_referable<const std::shared_ptr<T>&, TInjector>
+    > operator const std::shared_ptr<T>&() const {
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<const std::shared_ptr<T>&>{});
     }
 
     const TInjector& injector_;
 };
 
-template<class TParent, class TInjector>
+template<class TParent, class TInjector, class TCallPolicies = std::true_type>
 struct any_type_ref {
     template<class T, class = is_not_same<T, TParent>>
     operator T() {
-        return injector_.create_successful_impl(aux::type<T>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T>{});
     }
 
     #if defined(BOOST_DI_GCC)
@@ -120,7 +135,7 @@ struct any_type_ref {
                , class = is_not_same<T, TParent>
                , class = is_referable<T&&, TInjector>
         > operator T&&() const {
-            return injector_.create_successful_impl(aux::type<T&&>{});
+            return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T&&>{});
         }
     #endif
 
@@ -128,14 +143,14 @@ struct any_type_ref {
            , class = is_not_same<T, TParent>
            , class = is_referable<T&, TInjector>
     > operator T&() const {
-        return injector_.create_successful_impl(aux::type<T&>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<T&>{});
     }
 
     template<class T
            , class = is_not_same<T, TParent>
            , class = is_referable<const T&, TInjector>
     > operator const T&() const {
-        return injector_.create_successful_impl(aux::type<const T&>{});
+        return injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<const T&>{});
     }
 
     const TInjector& injector_;
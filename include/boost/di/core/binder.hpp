@@ -14,17 +14,48 @@
 
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
+class binder;
+
+// parent of the child injector, types not bound by the child are resolved by its bindings
+template<class TInjector>
+class parent {
+    friend class binder;
+
+public:
+    explicit parent(const TInjector& injector) noexcept
+        : parent_(&injector)
+    { }
+
+private:
+    const TInjector* parent_ = nullptr;
+};
+
+template<class T>
+struct get_parent {
+    using type = aux::type_list<>;
+};
+
+template<class TInjector>
+struct get_parent<parent<TInjector>> {
+    using type = aux::type_list<parent<TInjector>>;
+};
+
+template<class... Ts>
+using parents_t = aux::join_t<typename get_parent<Ts>::type...>;
+
 class binder {
+public:
+    static void parent_impl(...) noexcept;
+
+    template<class TInjector>
+    static TInjector parent_impl(const parent<TInjector>*) noexcept;
+
+private:
     template<class TDefault, class>
-    static TDefault resolve_impl(...) noexcept {
-        return {};
-    }
+    static TDefault resolve_impl(...) noexcept;
 
     template<class, class TConcept, class TDependency>
-    static decltype(auto)
-    resolve_impl(aux::pair<TConcept, TDependency>* dep) noexcept {
-        return static_cast<TDependency&>(*dep);
-    }
+    static TDependency& resolve_impl(aux::pair<TConcept, TDependency>*) noexcept;
 
     template<
         class
@@ -33,21 +64,91 @@ class binder {
       , class TExpected
       , class TGiven
       , class TName
-    > static decltype(auto)
-    resolve_impl(aux::pair<TConcept
-               , dependency<TScope, TExpected, TGiven, TName, override>>* dep) noexcept {
-        return static_cast<dependency<TScope, TExpected, TGiven, TName, override>&>(*dep);
-    }
+    > static dependency<TScope, TExpected, TGiven, TName, override>&
+    resolve_impl(aux::pair<TConcept, dependency<TScope, TExpected, TGiven, TName, override>>*) noexcept;
+
+    template<class TDeps>
+    struct parent_type { // parents are private bases of injectors
+        using type = decltype(parent_impl((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class T, class TName, class TDefault, class TParent = typename parent_type<TDeps>::type>
+    struct resolve_type { // bindings of the parent are the default of the child
+        using type = decltype(resolve_impl<
+            typename resolve_type<TParent, T, TName, TDefault>::type
+          , dependency_concept<aux::decay_t<T>, TName>
+        >((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class T, class TName, class TDefault>
+    struct resolve_type<TDeps, T, TName, TDefault, void> {
+        using type = decltype(resolve_impl<TDefault, dependency_concept<aux::decay_t<T>, TName>>((TDeps*)nullptr));
+    };
+
+    template<class TDeps, class TDependency, class TParent = typename parent_type<TDeps>::type>
+    struct owner_type {
+        using type = std::conditional_t<
+            std::is_base_of<TDependency, TDeps>::value
+          , TDeps
+          , typename owner_type<TParent, TDependency>::type
+        >;
+    };
+
+    template<class TDependency>
+    struct owner_type<void, TDependency, void> {
+        using type = void;
+    };
 
 public:
+    /**
+     * Bound dependency (reference) or `TDefault`, memoized per requested type and name
+     */
+    template<
+        class TDeps
+      , class T
+      , class TName = no_name
+      , class TDefault = dependency<scopes::deduce, aux::decay_t<T>>
+    > using resolve_t = typename resolve_type<TDeps, T, TName, TDefault>::type;
+
+    /**
+     * Symbols depend on the dependency type only, not on the (possibly huge) injector type
+     */
+    template<class TDependency>
+    static std::enable_if_t<std::is_reference<TDependency>::value, TDependency>
+    get(std::remove_reference_t<TDependency>* dep) noexcept {
+        return *dep;
+    }
+
+    template<class TDependency, class TDeps, BOOST_DI_REQUIRES(
+        std::is_reference<TDependency>::value && !std::is_base_of<std::remove_reference_t<TDependency>, TDeps>::value
+    )> static TDependency get(TDeps* deps) noexcept { // bound by the parent
+        return get<TDependency>(parent_of(deps));
+    }
+
+    template<class TDefault>
+    static std::enable_if_t<!std::is_reference<TDefault>::value, TDefault>
+    get(const void*) noexcept {
+        return {};
+    }
+
+    template<class TInjector>
+    static TInjector* parent_of(const parent<TInjector>* deps) noexcept {
+        return const_cast<TInjector*>(deps->parent_);
+    }
+
+    /**
+     * Injector (`TDeps` or one of its parents) which binds `TDependency`
+     */
+    template<class TDeps, class TDependency>
+    using owner_t = typename owner_type<TDeps, TDependency>::type;
+
     template<
         class T
       , class TName = no_name
       , class TDefault = dependency<scopes::deduce, aux::decay_t<T>>
       , class TDeps = void
-    > static decltype(auto) resolve(TDeps* deps) noexcept {
-        using dependency = dependency_concept<aux::decay_t<T>, TName>;
-        return resolve_impl<TDefault, dependency>(deps);
+    > static resolve_t<TDeps, T, TName, TDefault> resolve(TDeps* deps) noexcept {
+        return get<resolve_t<TDeps, T, TName, TDefault>>(deps);
     }
 };
 
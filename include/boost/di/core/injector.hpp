@@ -18,12 +18,17 @@
 #include "boost/di/core/provider.hpp"
 #include "boost/di/core/transform.hpp"
 #include "boost/di/core/wrapper.hpp"
+#include "boost/di/scopes/deduce.hpp"
 #include "boost/di/scopes/exposed.hpp"
+#include "boost/di/scopes/external.hpp"
+#include "boost/di/scopes/unique.hpp"
 #include "boost/di/type_traits/ctor_traits.hpp"
 #include "boost/di/type_traits/config_traits.hpp"
 #include "boost/di/type_traits/referable_traits.hpp"
+#include "boost/di/type_traits/scope_traits.hpp"
 #include "boost/di/concepts/creatable.hpp"
 #include "boost/di/config.hpp"
+#include "boost/di/lazy.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
@@ -34,14 +39,94 @@ struct from_deps { };
 struct init { };
 struct with_error { };
 
+// private interface of the injector used by opt-in headers (ex. `boost/di/warm_up.hpp`, `boost/di/async.hpp`)
+struct injector_access {
+    template<class TInjector, class T, class TName = no_name>
+    struct is_creatable : TInjector::template is_creatable<T, TName, std::true_type> { };
+
+    template<class TIsRoot, class TCallPolicies, class TInjector, class T>
+    static auto create(const TInjector& injector, const aux::type<T>& type) {
+        return injector.template create_successful_impl<TIsRoot, TCallPolicies>(type);
+    }
+
+    // objects required by `T` are created by `injector_`
+    template<class TIsRoot, class TCallPolicies, class T, class TName, class TInjector, class TInjector_>
+    static auto create(const TInjector& injector, const TInjector_& injector_) {
+        return injector.template create_successful_impl__<TIsRoot, TCallPolicies, T, TName>(injector_);
+    }
+
+    template<class TSlot, class TInjector>
+    static TSlot& slot(const TInjector& injector) noexcept {
+        return injector.template slot<TSlot>();
+    }
+};
+
+// `injector.create_async<T>(executor)` is implemented by `boost/di/async.hpp`, which might not be included
+template<class... TArgs>
+inline void create_async_injector(const TArgs&...) {
+    static_assert(aux::never<aux::type_list<TArgs...>>::value, "`injector.create_async<T>(executor)` requires `boost/di/async.hpp`");
+}
+
+// `injector.warm_up(...)` is implemented by `boost/di/warm_up.hpp`, which might not be included
+template<class TInjector, class... TArgs>
+inline void warm_up_injector(const TInjector&, const TArgs&...) {
+    static_assert(aux::never<TInjector>::value, "`injector.warm_up(...)` requires `boost/di/warm_up.hpp`");
+}
+
 template<class T, class TInjector>
 inline auto build(const TInjector& injector) noexcept {
     return T{injector};
 }
 
+// instances of scopes keeping them might outlive the child injector, so bindings of the parent
+// with such scopes are created by the parent (see `make_child_injector`)
+template<class TScope, class T>
+struct keeps_instances : std::true_type { };
+
+template<class T>
+struct keeps_instances<scopes::deduce, T> : keeps_instances<type_traits::scope_traits_t<T>, T> { };
+
+template<class T>
+struct keeps_instances<scopes::unique, T> : std::false_type { };
+
+template<class T>
+struct keeps_instances<scopes::external, T> : std::false_type { };
+
+template<class TScope, class T>
+struct keeps_instances<scopes::exposed<TScope>, T> : std::false_type { }; // created by the module
+
+// storage of a binding kept by the injector when its scope defines `slot` (ex. `boost/di/scopes/injector_singleton.hpp`)
+template<class, class = void>
+struct get_slot {
+    using type = aux::type_list<>;
+};
+
+template<class TScope, class TExpected, class TGiven, class TName, class TPriority>
+struct get_slot<
+    dependency<TScope, TExpected, TGiven, TName, TPriority>
+  , typename aux::void_t<typename TScope::template slot<TExpected, TGiven, TName>>::type
+> {
+    using type = aux::type_list<typename TScope::template slot<TExpected, TGiven, TName>>;
+};
+
+// slots are laid out next to each other, slot is found by its binding at compile time
+template<class>
+struct slots;
+
+template<class... TSlots>
+struct slots<aux::type_list<TSlots...>> : TSlots... { };
+
+template<class>
+struct get_slots;
+
+template<class... TDeps>
+struct get_slots<aux::type_list<TDeps...>> {
+    using type = slots<aux::join_t<typename get_slot<TDeps>::type...>>;
+};
+
 template<class T>
-inline decltype(auto) get_arg(const T& arg, const std::false_type&) noexcept {
-    return arg;
+inline T&& get_arg(T&& arg, const std::false_type&) noexcept {
+    return std::forward<T>(arg);
 }
 
 template<class T>
@@ -6,7 +6,8 @@
 //
 template<class TConfig BOOST_DI_CORE_INJECTOR_POLICY(, class TPolicies = pool<>)(), class... TDeps>
 class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
-    : pool<transform_t<TDeps...>>
+    : pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>
+    , get_slots<transform_t<TDeps...>>::type
     , public type_traits::config_traits_t<
           TConfig
         , injector<TConfig, BOOST_DI_CORE_INJECTOR_POLICY(TPolicies)(pool<>), TDeps...>
@@ -17,15 +18,18 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     template<class> friend class pool;
     template<class> friend class scopes::exposed;
     template<class, class, class> friend struct any_type;
-    template<class, class> friend struct successful::any_type;
+    template<class, class, class> friend struct successful::any_type;
     template<class, class, class> friend struct any_type_ref;
-    template<class, class> friend struct successful::any_type_ref;
+    template<class, class, class> friend struct successful::any_type_ref;
     template<class, class, class, class> friend struct try_provider;
     template<class, class, class, class, class> friend struct provider;
-    template<class, class, class, class> friend struct successful::provider;
+    template<class, class, class, class, class> friend struct successful::provider;
     template<class, class, class> friend struct is_creatable_impl;
+    friend struct injector_access;
+    template<class, class, class...> friend class injector;
 
-    using pool_t = pool<transform_t<TDeps...>>;
+    using pool_t = pool<aux::join_t<parents_t<TDeps...>, transform_t<TDeps...>>>;
+    using copyable_t = aux::join_t<parents_t<TDeps...>, copyable<transform_t<TDeps...>>>;
     using is_root_t = std::true_type;
     using config_t = type_traits::config_traits_t<TConfig, injector>;
     using config = std::conditional_t<
@@ -34,20 +38,29 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
       , config_t
     >;
 
+    template<class T, class TName, class TDependency = binder::resolve_t<injector, T, TName>>
+    using creator_t = std::conditional_t<
+        std::is_reference<TDependency>::value &&
+        keeps_instances<typename std::remove_reference_t<TDependency>::scope, T>::value
+      , binder::owner_t<injector, std::remove_reference_t<TDependency>>
+      , injector
+    >;
+
     template<
         class T
       , class TName = no_name
       , class TIsRoot = std::false_type
-      , class TDependency = std::remove_reference_t<decltype(binder::resolve<T, TName>((injector*)0))>
+      , class TDependency = std::remove_reference_t<binder::resolve_t<injector, T, TName>>
       , class TCtor = typename type_traits::ctor_traits<typename TDependency::given>::type
+      , class TCreator = creator_t<T, TName>
     > static auto try_create_impl() -> std::enable_if_t<std::is_convertible<
        decltype(
            std::declval<TDependency>().template try_create<T>(
                try_provider<
                    typename TDependency::given
                  , TCtor
-                 , injector
-                 , decltype(((TConfig*)0)->provider())
+                 , TCreator
+                 , decltype(std::declval<TCreator&>().provider())
                >{}
            )
        ), T>::value BOOST_DI_CORE_INJECTOR_POLICY(
@@ -65,6 +78,10 @@ class injector BOOST_DI_CORE_INJECTOR_POLICY()(<TConfig, pool<>, TDeps...>)
     static auto is_creatable_impl(T&&, TName&&, TIsRoot&&)
         -> aux::is_valid_expr<decltype(try_create_impl<T, TName, TIsRoot>())>;
 
+    template<class T, class TThreadSafe, class TName, class TIsRoot>
+    static auto is_creatable_impl(lazy<T, TThreadSafe>&&, TName&&, TIsRoot&&)
+        -> aux::is_valid_expr<decltype(try_create_impl<T, TName>())>;
+
     template<class T, class TName = no_name, class TIsRoot = std::false_type>
     #if defined(BOOST_DI_MSVC)
         struct is_creatable : std::false_type { };
@@ -97,8 +114,8 @@ public:
     using deps = transform_t<TDeps...>;
 
     template<class... TArgs>
-    explicit injector(const init&, const TArgs&... args) noexcept
-        : injector{from_deps{}, get_arg(args, has_configure<decltype(args)>{})...}
+    explicit injector(const init&, TArgs&&... args) noexcept
+        : injector{from_deps{}, get_arg(std::forward<TArgs>(args), has_configure<std::decay_t<TArgs>>{})...}
     { }
 
     template<class TConfig_, class TPolicies_, class... TDeps_>
@@ -117,6 +134,42 @@ public:
         return create_impl<is_root_t>(aux::type<T>{});
     }
 
+    /**
+     * Creation plan for `T`, resolved and verified (policies constraints included) once
+     * Calling it creates `T` without calling policies, use `create<T>` when they have to be called for every object
+     * Plan holds only a pointer to the injector, so the injector has to outlive it
+     */
+    template<class T, BOOST_DI_REQUIRES(is_creatable<T, no_name, is_root_t>::value)>
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_successful_impl<is_root_t, std::false_type>(aux::type<T>{});
+        };
+    }
+
+    template<class T, BOOST_DI_REQUIRES(!is_creatable<T, no_name, is_root_t>::value)>
+    BOOST_DI_CONCEPTS_CREATABLE_ATTR
+    auto make_factory() const noexcept {
+        return [this]() -> T {
+            return create_impl<is_root_t>(aux::type<T>{});
+        };
+    }
+
+    /**
+     * Creates `T` asynchronously, requires `boost/di/async.hpp` (see `create_async`)
+     */
+    template<class T, class TExecutor>
+    auto create_async(const TExecutor& executor) const {
+        return create_async_injector(*this, executor, aux::type<T>{});
+    }
+
+    /**
+     * Creates instances of scopes keeping them up front, requires `boost/di/warm_up.hpp` (see `warm_up_injector`)
+     */
+    template<class... TArgs>
+    void warm_up(const TArgs&... args) const {
+        warm_up_injector(*this, args...);
+    }
+
     template<class TAction>
     void call(const TAction& action) {
         call_impl(action, deps{});
@@ -124,17 +177,64 @@ public:
 
 private:
     template<class... TArgs>
-    explicit injector(const from_deps&, const TArgs&... args) noexcept
-        : pool_t{copyable<deps>{}, core::pool_t<TArgs...>{args...}}
+    explicit injector(const from_deps&, TArgs&&... args) noexcept
+        : pool_t{copyable_t{}, core::pool_t<std::decay_t<TArgs>...>{std::forward<TArgs>(args)...}}
         , config{*this}
     { }
 
+    /**
+     * Module injector is copied once per conversion and shared by all exposed types and copies of this injector
+     */
     template<class TInjector, class... TArgs>
-    explicit injector(const from_injector&, const TInjector& injector, const aux::type_list<TArgs...>&) noexcept
-        : pool_t{copyable<deps>{}, pool_t{build<TArgs>(injector)...}}
+    explicit injector(const from_injector&, const TInjector& other, const aux::type_list<TArgs...>& args) noexcept
+        : injector{from_injector{}, std::make_shared<TInjector>(other), args}
+    { }
+
+    template<class TInjector>
+    explicit injector(const from_injector&, const TInjector&, const aux::type_list<>&) noexcept
+        : pool_t{}
+        , config{*this}
+    { }
+
+    template<class TInjector, class... TArgs>
+    explicit injector(const from_injector&, const std::shared_ptr<TInjector>& injector, const aux::type_list<TArgs...>&) noexcept
+        : pool_t{copyable_t{}, pool_t{build<TArgs>(injector)...}}
         , config{*this}
     { }
 
+    template<class TSlot>
+    TSlot& slot() const noexcept {
+        return slot<TSlot>((injector*)this);
+    }
+
+    /**
+     * Injector creating objects required by `T`, the parent binding `T` in a scope keeping its instances
+     */
+    template<class T, class TName>
+    const creator_t<T, TName>& creator() const noexcept {
+        return creator<creator_t<T, TName>>((injector*)this);
+    }
+
+    template<class TCreator>
+    static const TCreator& creator(const TCreator* injector) noexcept {
+        return *injector;
+    }
+
+    template<class TCreator, class TInjector, BOOST_DI_REQUIRES(!std::is_same<TCreator, TInjector>::value)>
+    static const TCreator& creator(const TInjector* injector) noexcept {
+        return creator<TCreator>(binder::parent_of(injector));
+    }
+
+    template<class TSlot>
+    static TSlot& slot(TSlot* slot) noexcept {
+        return *slot;
+    }
+
+    template<class TSlot, class TInjector, BOOST_DI_REQUIRES(!std::is_base_of<TSlot, TInjector>::value)>
+    static TSlot& slot(TInjector* injector) noexcept { // binding of the parent
+        return slot<TSlot>(binder::parent_of(injector));
+    }
+
     template<class TIsRoot = std::false_type, class T>
     auto create_impl(const aux::type<T>&) const {
         return create_impl__<TIsRoot, T>();
@@ -155,61 +255,129 @@ private:
         return create_impl__<TIsRoot, T, TName>();
     }
 
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe>
+    auto create_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_lazy_impl<T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class T, class TThreadSafe, class TName>
+    auto create_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_lazy_impl<T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_successful_lazy_impl<std::true_type, T, TName, TThreadSafe>();
+    }
+
+    template<class T, class TName, class TThreadSafe, BOOST_DI_REQUIRES(!is_creatable<T, TName>::value)>
+    auto create_lazy_impl() const {
+        return create_impl__<std::false_type, T, TName>();
+    }
+
     template<class TIsRoot = std::false_type, class T, class TName = no_name>
     auto create_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = core::provider<expected_t, given_t, TName, ctor_t, creator_t<T, TName>>;
+        const auto& creator_ = creator<T, TName>();
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{creator_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
         BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+            using arg_t = arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>;
+            const auto& policies = ((TConfig&)*this).policies();
+            policy::template call<arg_t>(policies, dependency, ctor_t{});
+            using keeps_instances_t = keeps_instances<typename dependency_t::scope, T>;
+            policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, dependency_t, keeps_instances_t> guard{policies, dependency};
+            wrapper<create_t, wrapper_t> object{dependency.template create<T>(guard.make_provider(provider_t{creator_}))};
+            guard.created();
+            return object;
+        )(
+            return wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{creator_})};
+        )
     }
 
-    template<class TIsRoot = std::false_type, class T>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T>
     auto create_successful_impl(const aux::type<T>&) const {
-        return create_successful_impl__<TIsRoot, T>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T>();
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_fwd<TParent>>&) const {
-        return successful::any_type<TParent, injector>{*this};
+        return successful::any_type<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class TParent>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class TParent>
     auto create_successful_impl(const aux::type<any_type_ref_fwd<TParent>>&) const {
-        return successful::any_type_ref<TParent, injector>{*this};
+        return successful::any_type_ref<TParent, injector, TCallPolicies>{*this};
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName>
     auto create_successful_impl(const aux::type<type_traits::named<TName, T>>&) const {
-        return create_successful_impl__<TIsRoot, T, TName>();
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>();
     }
 
-    template<class TIsRoot = std::false_type, class T, class TName = no_name>
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe>
+    auto create_successful_impl(const aux::type<lazy<T, TThreadSafe>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, no_name, TThreadSafe>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TThreadSafe, class TName>
+    auto create_successful_impl(const aux::type<type_traits::named<TName, lazy<T, TThreadSafe>>>&) const {
+        return create_successful_lazy_impl<TCallPolicies, T, TName, TThreadSafe>();
+    }
+
+    template<class TCallPolicies, class T, class TName, class TThreadSafe>
+    auto create_successful_lazy_impl() const noexcept {
+        return lazy<T, TThreadSafe>{this, &injector::create_lazy<TCallPolicies, T, TName>};
+    }
+
+    template<class TCallPolicies, class T, class TName>
+    static T create_lazy(const void* injector_) {
+        return static_cast<const injector*>(injector_)->template create_successful_impl__<std::false_type, TCallPolicies, T, TName>();
+    }
+
+    template<class TIsRoot = std::false_type, class TCallPolicies = std::true_type, class T, class TName = no_name>
     auto create_successful_impl__() const {
-        auto&& dependency = binder::resolve<T, TName>((injector*)this);
+        return create_successful_impl__<TIsRoot, TCallPolicies, T, TName>(creator<T, TName>());
+    }
+
+    template<class TIsRoot, class TCallPolicies, class T, class TName, class TInjector>
+    auto create_successful_impl__(const TInjector& injector_) const {
+        auto&& dependency = binder::get<binder::resolve_t<injector, T, TName>>((injector*)this);
         using dependency_t = std::remove_reference_t<decltype(dependency)>;
         using expected_t = typename dependency_t::expected;
         using given_t = typename dependency_t::given;
         using ctor_t = typename type_traits::ctor_traits<given_t>::type;
-        using provider_t = successful::provider<expected_t, given_t, ctor_t, injector>;
-        using wrapper_t = decltype(dependency.template create<T>(provider_t{*this}));
+        using provider_t = successful::provider<expected_t, given_t, TName, ctor_t, TInjector, TCallPolicies>;
+        using wrapper_t = decltype(dependency.template create<T>(provider_t{injector_}));
         using create_t = type_traits::referable_traits_t<T, dependency_t>;
-        BOOST_DI_CORE_INJECTOR_POLICY(
-            policy::template call<arg_wrapper<create_t, TName, TIsRoot, pool_t, std::true_type>>(
-                ((TConfig&)*this).policies(), dependency, ctor_t{}
-            );
-        )()
-        return successful::wrapper<create_t, wrapper_t>{dependency.template create<T>(provider_t{*this})};
+        return create_successful_policies_impl<TIsRoot, T, TName, create_t, wrapper_t, ctor_t>(
+            dependency, provider_t{injector_} BOOST_DI_CORE_INJECTOR_POLICY(, TCallPolicies{})()
+        );
+    }
+
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider BOOST_DI_CORE_INJECTOR_POLICY(, const std::false_type&)()) const {
+        return successful::wrapper<TCreate, TWrapper>{dependency.template create<T>(provider)};
+    }
+
+    BOOST_DI_CORE_INJECTOR_POLICY(
+    template<class TIsRoot, class T, class TName, class TCreate, class TWrapper, class TCtor, class TDependency, class TProvider>
+    auto create_successful_policies_impl(TDependency& dependency, const TProvider& provider, const std::true_type&) const {
+        using arg_t = arg_wrapper<TCreate, TName, TIsRoot, pool_t, std::true_type>;
+        const auto& policies = ((TConfig&)*this).policies();
+        policy::template call<arg_t>(policies, dependency, TCtor{});
+        using keeps_instances_t = keeps_instances<typename TDependency::scope, T>;
+        policy::guard<arg_t, std::remove_reference_t<decltype(policies)>, TDependency, keeps_instances_t> guard{policies, dependency};
+        successful::wrapper<TCreate, TWrapper> object{dependency.template create<T>(guard.make_provider(provider))};
+        guard.created();
+        return object;
     }
+    )()
 
     template<class TAction, class... Ts>
     void call_impl(const TAction& action, const aux::type_list<Ts...>&) {
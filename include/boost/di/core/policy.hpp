@@ -11,10 +11,14 @@
 #include "boost/di/aux_/type_traits.hpp"
 #include "boost/di/core/binder.hpp"
 #include "boost/di/core/pool.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
 BOOST_DI_HAS_METHOD(call_operator, operator());
+BOOST_DI_HAS_METHOD(created, created);
+BOOST_DI_HAS_METHOD(cached, cached);
+BOOST_DI_HAS_METHOD(failed, failed);
 
 template<
     class T
@@ -29,7 +33,7 @@ template<
     using ignore = TIgnore;
 
     template<class T_, class TName_, class TDefault_>
-    using resolve = decltype(core::binder::resolve<T_, TName_, TDefault_>((TDeps*)0));
+    using resolve = core::binder::resolve_t<TDeps, T_, TName_, TDefault_>;
 };
 
 template<class T>
@@ -65,6 +69,47 @@ class policy {
         (policy)(TArg{}, dependency, aux::type<TCtor>{}...);
     }
 
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void created_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        created_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_created<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void created_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.created(TArg{}, dependency);
+    }
+
+    template<class, class TPolicy, class TDependency>
+    static void created_impl__(const TPolicy&, TDependency&, const std::false_type&) noexcept { }
+
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void cached_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        cached_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_cached<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void cached_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.cached(TArg{}, dependency);
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void cached_impl__(const TPolicy& policies, TDependency& dependency, const std::false_type&) noexcept {
+        created_impl__<TArg>(policies, dependency, has_created<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TPolicies, class TDependency>
+    static void failed_impl(const TPolicies& policies, TDependency& dependency) noexcept {
+        failed_impl__<TArg>(static_cast<const TPolicy&>(policies), dependency, has_failed<const TPolicy&, TArg, TDependency&>{});
+    }
+
+    template<class TArg, class TPolicy, class TDependency>
+    static void failed_impl__(const TPolicy& policy, TDependency& dependency, const std::true_type&) noexcept {
+        policy.failed(TArg{}, dependency);
+    }
+
+    template<class, class TPolicy, class TDependency>
+    static void failed_impl__(const TPolicy&, TDependency&, const std::false_type&) noexcept { }
+
     template<class, class, class, class, class = void>
     struct try_call_impl;
 
@@ -98,6 +143,83 @@ public:
                    , BOOST_DI_UNUSED const TCtor& ctor) noexcept {
         int _[]{0, (call_impl<TArg, TPolicies>(policies, dependency, ctor), 0)...}; (void)_;
     }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void created(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                      , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (created_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void cached(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                     , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (cached_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    template<class TArg, class TDependency, class... TPolicies>
+    static void failed(BOOST_DI_UNUSED const pool_t<TPolicies...>& policies
+                     , BOOST_DI_UNUSED TDependency& dependency) noexcept {
+        int _[]{0, (failed_impl<TArg, TPolicies>(policies, dependency), 0)...}; (void)_;
+    }
+
+    /**
+     * Calls `created` once the object was created, `failed` when its creation threw
+     * and `cached` (`created` unless defined) when scope keeping instances returned it without calling the provider
+     */
+    template<class TArg, class TPolicies, class TDependency, class TKeepsInstances = std::false_type>
+    class guard {
+    public:
+        // marks the object as created when the scope calls the provider
+        template<class TProvider>
+        class provider : public TProvider {
+        public:
+            provider(const TProvider& provider, guard& guard) noexcept
+                : TProvider(provider), guard_(guard)
+            { }
+
+            template<class TMemory = type_traits::heap>
+            auto get(const TMemory& memory = {}) const {
+                guard_.provided_ = true;
+                return TProvider::get(memory);
+            }
+
+        private:
+            guard& guard_;
+        };
+
+        guard(const TPolicies& policies, TDependency& dependency) noexcept
+            : policies_(policies), dependency_(dependency)
+        { }
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+        ~guard() noexcept {
+            if (!created_) {
+                policy::failed<TArg>(policies_, dependency_);
+            }
+        }
+
+        template<class TProvider>
+        auto make_provider(const TProvider& provider) noexcept {
+            return guard::provider<TProvider>{provider, *this};
+        }
+
+        void created() noexcept {
+            created_ = true;
+            if (TKeepsInstances::value && !provided_) {
+                policy::cached<TArg>(policies_, dependency_);
+            } else {
+                policy::created<TArg>(policies_, dependency_);
+            }
+        }
+
+    private:
+        const TPolicies& policies_;
+        TDependency& dependency_;
+        bool created_ = false;
+        bool provided_ = false;
+    };
 };
 
 }}}} // boost::di::v1::core
@@ -21,14 +21,20 @@ using pool_t = pool<aux::type_list<TArgs...>>;
 template<class... TArgs>
 class pool<aux::type_list<TArgs...>> : public TArgs... {
 public:
-    template<class... Ts>
-    explicit pool(const Ts&... args) noexcept
-        : Ts(args)...
+    template<class... Ts, BOOST_DI_REQUIRES(std::is_same<
+        aux::bool_list<aux::never<Ts>::value...>
+      , aux::bool_list<std::is_same<pool, std::decay_t<Ts>>::value...>
+    >::value)>
+    explicit pool(Ts&&... args) noexcept
+        : std::decay_t<Ts>(std::forward<Ts>(args))...
     { }
 
+    /**
+     * Subset of `p`, moved when `p` is an rvalue
+     */
     template<class... Ts, class TPool>
-    pool(const aux::type_list<Ts...>&, const TPool& p) noexcept
-        : pool(static_cast<const Ts&>(p)...)
+    pool(aux::type_list<Ts...>&&, TPool&& p) noexcept
+        : pool(static_cast<std::conditional_t<std::is_lvalue_reference<TPool>::value, const Ts&, Ts&&>>(p)...)
     { }
 };
 
@@ -7,16 +7,101 @@
 #ifndef BOOST_DI_CORE_PROVIDER_HPP
 #define BOOST_DI_CORE_PROVIDER_HPP
 
+#include <memory>
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/local_shared_ptr.hpp"
 #include "boost/di/concepts/creatable.hpp"
 #include "boost/di/type_traits/memory_traits.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace core {
 
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class TMemory, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const TMemory& memory, TArgs&&... args) {
+    return provider.template get<TExpected, TGiven>(initialization, memory, std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_shared(TProvider&& provider, const TInitialization& initialization, int, TArgs&&... args)
+    -> decltype(std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::shared_heap{}, std::forward<TArgs>(args)...)}) {
+    return std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::shared_heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return std::shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TGiven, class TProvider>
+using provider_allocator_t = typename std::allocator_traits<
+    aux::decay_t<decltype(std::declval<TProvider&>().allocator())>
+>::template rebind_alloc<TGiven>;
+
+template<class TExpected, class TGiven, class TProvider, class... TArgs>
+inline auto provide_allocate_shared(TProvider&& provider, const type_traits::direct&, int, TArgs&&... args)
+    -> decltype(std::allocate_shared<TGiven>(std::declval<provider_allocator_t<TGiven, TProvider>>(), std::forward<TArgs>(args)...)) {
+    return std::allocate_shared<TGiven>(provider_allocator_t<TGiven, TProvider>(provider.allocator()), std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider>
+inline auto provide_allocate_shared(TProvider&& provider, const type_traits::uniform&, int)
+    -> decltype(std::allocate_shared<TGiven>(std::declval<provider_allocator_t<TGiven, TProvider>>())) {
+    return std::allocate_shared<TGiven>(provider_allocator_t<TGiven, TProvider>(provider.allocator()));
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_allocate_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return provide_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
+// providers with `allocator()` allocate shared instances and their reference counters at once with it (`std::allocate_shared`),
+// uniform initialization with arguments is left to the provider, which can't be done by `std::allocate_shared`
+// providers without `shared_heap` support are asked for `heap` and the result is wrapped by std::shared_ptr
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const type_traits::shared_heap&, TArgs&&... args) {
+    return provide_allocate_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_local_shared(TProvider&& provider, const TInitialization& initialization, int, TArgs&&... args)
+    -> decltype(local_shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::local_shared_heap{}, std::forward<TArgs>(args)...)}) {
+    return local_shared_ptr<TGiven>{provider.template get<TExpected, TGiven>(initialization, type_traits::local_shared_heap{}, std::forward<TArgs>(args)...)};
+}
+
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide_local_shared(TProvider&& provider, const TInitialization& initialization, long, TArgs&&... args) {
+    return local_shared_ptr<TGiven>{provide_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...)};
+}
+
+// providers without `local_shared_heap` support are asked for `shared_heap` and the result is wrapped by `local_shared_ptr`
+template<class TExpected, class TGiven, class TProvider, class TInitialization, class... TArgs>
+inline auto provide(TProvider&& provider, const TInitialization& initialization, const type_traits::local_shared_heap&, TArgs&&... args) {
+    return provide_local_shared<TExpected, TGiven>(provider, initialization, 0, std::forward<TArgs>(args)...);
+}
+
 template<class, class, class, class>
 struct try_provider;
 
+template<class TGiven, class TMemory>
+struct provided_type {
+    using type = TGiven*;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::stack> {
+    using type = TGiven;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::shared_heap> {
+    using type = std::shared_ptr<TGiven>;
+};
+
+template<class TGiven>
+struct provided_type<TGiven, type_traits::local_shared_heap> {
+    using type = local_shared_ptr<TGiven>;
+};
+
 template<
     class TGiven
   , class TInjector
@@ -38,7 +123,7 @@ template<
     template<class TMemory = type_traits::heap>
     auto get(const TMemory& memory = {}) const -> std::enable_if_t<
         is_creatable<TMemory>::value
-      , std::conditional_t<std::is_same<TMemory, type_traits::stack>::value, TGiven, TGiven*>
+      , typename provided_type<TGiven, TMemory>::type
     >;
 };
 
@@ -53,6 +138,7 @@ template<
   , class TInitialization
   , class... TCtor
 > struct provider<TExpected, TGiven, TName, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector> {
+    using name = TName;
     using provider_t = decltype(std::declval<TInjector>().provider());
 
     template<class TMemory, class... TArgs>
@@ -68,8 +154,9 @@ template<
 
     template<class TMemory, class... TArgs, BOOST_DI_REQUIRES(is_creatable<TMemory, TArgs...>::value)>
     auto get_impl(const TMemory& memory, TArgs&&... args) const {
-        return injector_.provider().template get<TExpected, TGiven>(
-            TInitialization{}
+        return provide<TExpected, TGiven>(
+            injector_.provider()
+          , TInitialization{}
           , memory
           , std::forward<TArgs>(args)...
         );
@@ -85,22 +172,27 @@ template<
 
 namespace successful {
 
-template<class, class, class, class>
+template<class, class, class, class, class, class = std::true_type>
 struct provider;
 
 template<
     class TExpected
   , class TGiven
+  , class TName
   , class TInjector
+  , class TCallPolicies
   , class TInitialization
   , class... TCtor
-> struct provider<TExpected, TGiven, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector> {
+> struct provider<TExpected, TGiven, TName, aux::pair<TInitialization, aux::type_list<TCtor...>>, TInjector, TCallPolicies> {
+    using name = TName;
+
     template<class TMemory = type_traits::heap>
     auto get(const TMemory& memory = {}) const {
-        return injector_.provider().template get<TExpected, TGiven>(
-            TInitialization{}
+        return provide<TExpected, TGiven>(
+            injector_.provider()
+          , TInitialization{}
           , memory
-          , injector_.create_successful_impl(aux::type<TCtor>{})...
+          , injector_.template create_successful_impl<std::false_type, TCallPolicies>(aux::type<TCtor>{})...
         );
     }
 
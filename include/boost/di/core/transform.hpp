@@ -10,6 +10,7 @@
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/aux_/type_traits.hpp"
 #include "boost/di/aux_/utility.hpp"
+#include "boost/di/core/binder.hpp"
 #include "boost/di/core/dependency.hpp"
 #include "boost/di/scopes/exposed.hpp"
 
@@ -50,6 +51,11 @@ struct add_type_list<T, std::false_type, std::false_type> {
     using type = aux::type_list<dependency<scopes::exposed<>, T>>;
 };
 
+template<class TInjector>
+struct add_type_list<parent<TInjector>, std::false_type, std::false_type> { // kept by the pool, see `parents_t`
+    using type = aux::type_list<>;
+};
+
 #if defined(BOOST_DI_MSVC)
     template<class... Ts>
     struct transform : aux::join_t<typename add_type_list<Ts>::type...> { };
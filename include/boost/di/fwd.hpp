@@ -7,6 +7,8 @@
 #ifndef BOOST_DI_FWD_HPP
 #define BOOST_DI_FWD_HPP
 
+#include <cstddef>
+
 namespace boost {
 
 template<class> class shared_ptr;
@@ -19,6 +21,8 @@ struct no_name {
 
 class config;
 
+template<class> class local_shared_ptr;
+
 template<class...> class injector;
 
 namespace aux { struct none_type; }
@@ -38,6 +42,8 @@ template<
 
 namespace providers { class heap; class stack_over_heap; } // providers
 
+namespace scopes { template<class, std::size_t, std::size_t> class pooled; class reloadable; class injector_singleton; } // scopes
+
 }}} // boost::di::v1
 
 #endif
@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_LAZY_HPP
+#define BOOST_DI_LAZY_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/aux_/type_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace aux {
+
+template<class T>
+class lazy_object {
+public:
+    template<class TCreate>
+    void construct(const TCreate& create) {
+        new (&storage_) T(create());
+    }
+
+    void destroy() noexcept {
+        get().~T();
+    }
+
+    T& get() noexcept {
+        return *reinterpret_cast<T*>(&storage_);
+    }
+
+private:
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage_;
+};
+
+template<class T>
+class lazy_object<T&> {
+public:
+    template<class TCreate>
+    void construct(const TCreate& create) {
+        object_ = std::addressof(create());
+    }
+
+    void destroy() noexcept { }
+
+    T& get() const noexcept {
+        return *object_;
+    }
+
+private:
+    T* object_ = nullptr;
+};
+
+template<class>
+class lazy_once;
+
+template<>
+class lazy_once<std::false_type> {
+public:
+    lazy_once() noexcept = default;
+
+    explicit lazy_once(bool done) noexcept
+        : done_(done)
+    { }
+
+    bool is_done() const noexcept {
+        return done_;
+    }
+
+    template<class TCall>
+    void call(const TCall& call) {
+        call();
+        done_ = true;
+    }
+
+private:
+    bool done_ = false;
+};
+
+// double-checked, `call` which threw is repeated by the next caller
+template<>
+class lazy_once<std::true_type> {
+public:
+    lazy_once() noexcept = default;
+
+    explicit lazy_once(bool done) noexcept
+        : done_(done)
+    { }
+
+    bool is_done() const noexcept {
+        return done_.load(std::memory_order_acquire);
+    }
+
+    template<class TCall>
+    void call(const TCall& call) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        if (!done_.load(std::memory_order_relaxed)) {
+            call();
+            done_.store(true, std::memory_order_release);
+        }
+    }
+
+private:
+    std::atomic<bool> done_{false};
+    std::mutex mutex_;
+};
+
+template<class T>
+inline T* lazy_arrow(T& object, const std::false_type&) noexcept {
+    return std::addressof(object);
+}
+
+template<class T>
+inline T& lazy_arrow(T& object, const std::true_type&) noexcept { // `operator->` of pointers is applied afterwards
+    return object;
+}
+
+} // aux
+
+// constructor parameter creating `T` on the first use through the binding of `T` (scope, provider, policies)
+// `lazy_mt<T>` may be used by many threads at the same time, `T` is created once, injector has to outlive both of them
+template<class T, class TThreadSafe = std::false_type>
+class lazy {
+    using create_t = T (*)(const void*);
+
+public:
+    using element_type = T;
+
+    lazy(const void* injector, create_t create) noexcept
+        : injector_(injector), create_(create)
+    { }
+
+    lazy(lazy&& other)
+        : injector_(other.injector_), create_(other.create_), once_(other.once_.is_done()) {
+        if (other.once_.is_done()) {
+            object_.construct([&]() -> T { return std::forward<T>(other.object_.get()); });
+        }
+    }
+
+    ~lazy() noexcept {
+        if (once_.is_done()) {
+            object_.destroy();
+        }
+    }
+
+    /**
+     * Creates `T` when it wasn't created yet
+     */
+    std::add_lvalue_reference_t<T> get() const {
+        if (BOOST_DI_UNLIKELY(!once_.is_done())) {
+            once_.call([this] { object_.construct([this]() -> T { return create_(injector_); }); });
+        }
+        return object_.get();
+    }
+
+    std::add_lvalue_reference_t<T> operator*() const {
+        return get();
+    }
+
+    decltype(auto) operator->() const {
+        using is_pointer = std::integral_constant<bool,
+            aux::is_smart_ptr<std::remove_cv_t<std::remove_reference_t<T>>>::value || std::is_pointer<std::remove_reference_t<T>>::value>;
+        return aux::lazy_arrow(get(), is_pointer{});
+    }
+
+    bool is_created() const noexcept {
+        return once_.is_done();
+    }
+
+private:
+    const void* injector_ = nullptr;
+    create_t create_ = nullptr;
+    mutable aux::lazy_once<TThreadSafe> once_;
+    mutable aux::lazy_object<T> object_;
+};
+
+template<class T>
+using lazy_mt = lazy<T, std::true_type>;
+
+}}} // boost::di::v1
+
+#endif
+
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_LOCAL_SHARED_PTR_HPP
+#define BOOST_DI_LOCAL_SHARED_PTR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace aux {
+
+// counter of local handles, which keep the block it belongs to (`owner`) alive whilst there are any
+struct local_shared_counter {
+    std::size_t count = 1;
+    std::shared_ptr<const void> owner;
+};
+
+// counter and the object in one allocation, next to the atomic counter of `std::shared_ptr`
+template<class T>
+struct local_shared_object : local_shared_counter {
+    template<class... TArgs>
+    explicit local_shared_object(TArgs&&... args)
+        : object(std::forward<TArgs>(args)...)
+    { }
+
+    T object;
+};
+
+// counter of the object owned by a smart pointer already
+template<class TOwner>
+struct local_shared_owner : local_shared_counter {
+    explicit local_shared_owner(TOwner&& object) noexcept
+        : object(std::move(object))
+    { }
+
+    TOwner object;
+};
+
+} // aux
+
+template<class> class local_shared_ptr;
+
+template<class T, class... TArgs>
+local_shared_ptr<T> make_local_shared(TArgs&&...);
+
+// shared handle with non-atomic reference counter, copies of one handle must not be made by different threads at the same time
+template<class T>
+class local_shared_ptr {
+    template<class> friend class local_shared_ptr;
+    template<class T_, class... TArgs> friend local_shared_ptr<T_> make_local_shared(TArgs&&...);
+
+public:
+    using element_type = T;
+
+    constexpr local_shared_ptr() noexcept { }
+
+    constexpr local_shared_ptr(std::nullptr_t) noexcept { } // non explicit
+
+    /**
+     * Shares the ownership, allocates the counter
+     */
+    template<class TOther, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    explicit local_shared_ptr(std::shared_ptr<TOther> object)
+        : local_shared_ptr{adopt(std::move(object))}
+    { }
+
+    /**
+     * Takes over the ownership, allocates the counter
+     */
+    template<class TOther, class TDeleter, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    explicit local_shared_ptr(std::unique_ptr<TOther, TDeleter> object)
+        : local_shared_ptr{adopt(std::move(object))}
+    { }
+
+    local_shared_ptr(const local_shared_ptr& other) noexcept
+        : object_(other.object_), counter_(other.counter_) {
+        acquire();
+    }
+
+    template<class TOther, class = std::enable_if_t<std::is_convertible<TOther*, T*>::value>>
+    local_shared_ptr(const local_shared_ptr<TOther>& other) noexcept // non explicit
+        : object_(other.object_), counter_(other.counter_) {
+        acquire();
+    }
+
+    local_shared_ptr(local_shared_ptr&& other) noexcept
+        : object_(other.object_), counter_(other.counter_) {
+        other.object_ = nullptr;
+        other.counter_ = nullptr;
+    }
+
+    ~local_shared_ptr() noexcept {
+        release();
+    }
+
+    local_shared_ptr& operator=(local_shared_ptr other) noexcept {
+        std::swap(object_, other.object_);
+        std::swap(counter_, other.counter_);
+        return *this;
+    }
+
+    void reset() noexcept {
+        release();
+        object_ = nullptr;
+        counter_ = nullptr;
+    }
+
+    T* get() const noexcept {
+        return object_;
+    }
+
+    std::add_lvalue_reference_t<T> operator*() const noexcept {
+        return *object_;
+    }
+
+    T* operator->() const noexcept {
+        return object_;
+    }
+
+    explicit operator bool() const noexcept {
+        return object_ != nullptr;
+    }
+
+    std::size_t use_count() const noexcept {
+        return counter_ ? counter_->count : 0;
+    }
+
+    /**
+     * `std::shared_ptr` sharing the ownership (atomic reference counter)
+     */
+    std::shared_ptr<T> to_shared_ptr() const noexcept {
+        return counter_ ? std::shared_ptr<T>{counter_->owner, object_} : nullptr;
+    }
+
+private:
+    template<class TBlock>
+    local_shared_ptr(T* object, std::shared_ptr<TBlock> block) noexcept
+        : object_(object), counter_(block.get()) {
+        counter_->owner = std::move(block);
+    }
+
+    template<class TOwner>
+    static local_shared_ptr adopt(TOwner object) {
+        if (!object) {
+            return {};
+        }
+        T* ptr = object.get();
+        return {ptr, std::make_shared<aux::local_shared_owner<TOwner>>(std::move(object))};
+    }
+
+    void acquire() noexcept {
+        if (counter_) {
+            ++counter_->count;
+        }
+    }
+
+    void release() noexcept {
+        if (counter_ && !--counter_->count) {
+            auto owner = std::move(counter_->owner); // might release the counter
+        }
+    }
+
+    T* object_ = nullptr;
+    aux::local_shared_counter* counter_ = nullptr;
+};
+
+// object, its non-atomic and atomic counters in one allocation
+template<class T, class... TArgs>
+inline local_shared_ptr<T> make_local_shared(TArgs&&... args) {
+    auto block = std::make_shared<aux::local_shared_object<T>>(std::forward<TArgs>(args)...);
+    T* object = &block->object;
+    return {object, std::move(block)};
+}
+
+}}} // boost::di::v1
+
+#endif
+
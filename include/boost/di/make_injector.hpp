@@ -18,12 +18,34 @@ namespace boost { namespace di { inline namespace v1 {
 template<
      class TConfig = ::BOOST_DI_CFG
    , class... TDeps
-   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<TDeps...>>)
+   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<std::decay_t<TDeps>...>>)
    , BOOST_DI_REQUIRES_MSG(concepts::configurable<TConfig>)
-> inline auto make_injector(const TDeps&... args) noexcept {
-    return core::injector<TConfig, decltype(((TConfig*)0)->policies()), TDeps...>{core::init{}, args...};
+> inline auto make_injector(TDeps&&... args) noexcept {
+    return core::injector<TConfig, decltype(std::declval<TConfig&>().policies()), std::decay_t<TDeps>...>{
+        core::init{}, std::forward<TDeps>(args)...
+    };
 }
 
+// injector layering `args` over `parent`, which is referenced (not copied) and has to outlive it
+// types bound by `args` are created by the child, other types by bindings of the parent (instances kept by scopes
+// of the parent are shared), constructor parameters are resolved by the child unless the binding of the parent keeps
+// its instances (ex. `shared`, `singleton`), such instances are created by the parent as they outlive the child
+template<
+     class TConfig = ::BOOST_DI_CFG
+   , class TParent
+   , class... TDeps
+   , BOOST_DI_REQUIRES(core::is_injector<TParent>::value)
+   , BOOST_DI_REQUIRES_MSG(concepts::boundable<aux::type_list<std::decay_t<TDeps>...>>)
+   , BOOST_DI_REQUIRES_MSG(concepts::configurable<TConfig>)
+> inline auto make_child_injector(const TParent& parent, TDeps&&... args) noexcept {
+    return core::injector<TConfig, decltype(std::declval<TConfig&>().policies()), core::parent<TParent>, std::decay_t<TDeps>...>{
+        core::init{}, core::parent<TParent>{parent}, std::forward<TDeps>(args)...
+    };
+}
+
+template<class TConfig = ::BOOST_DI_CFG, class TParent, class... TDeps>
+void make_child_injector(const TParent&&, TDeps&&...) = delete; // parent has to outlive the child
+
 }}} // boost::di::v1
 
 #endif
@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_POLICIES_PROFILER_HPP
+#define BOOST_DI_POLICIES_PROFILER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#if defined(__GNUC__)
+    #include <cstdlib>
+    #include <cxxabi.h>
+#endif
+#include "boost/di/aux_/type_traits.hpp"
+#include "boost/di/fwd.hpp"
+#include "boost/di/scopes/deduce.hpp"
+#include "boost/di/scopes/unique.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/type_traits/scope_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace policies {
+
+template<class T, class TScope>
+struct profiler_scope {
+    using type = TScope;
+};
+
+template<class T>
+struct profiler_scope<T, scopes::deduce> {
+    using type = type_traits::scope_traits_t<T>;
+};
+
+class profiler {
+    using clock = std::chrono::steady_clock;
+
+public:
+    static constexpr auto buckets = 64; // bucket `i` counts creations which took less than 2^i nanoseconds
+    static constexpr auto max_depth = 256; // creations nested deeper aren't recorded
+
+    /**
+     * Statistics of one binding (given type, name, scope)
+     * Latency includes creation of constructor parameters
+     * Bytes are counted for `unique` objects created on the heap, scopes keeping instances allocate them once
+     * Instances returned by scopes keeping them without creating are counted by `hits` only
+     */
+    struct binding {
+        std::chrono::nanoseconds percentile(double p) const noexcept {
+            const auto rank = static_cast<std::size_t>(p * count + 0.5);
+            auto calls = std::size_t{0};
+            for (auto i = 0; i < buckets; ++i) {
+                calls += histogram[i];
+                if (calls && calls >= rank) {
+                    return std::min(max, std::chrono::nanoseconds{std::chrono::nanoseconds::rep{1} << i});
+                }
+            }
+            return max;
+        }
+
+        std::string type;
+        std::string name;
+        std::string scope;
+        std::size_t count = 0;
+        std::size_t hits = 0;
+        std::size_t bytes = 0;
+        std::chrono::nanoseconds total{};
+        std::chrono::nanoseconds max{};
+        std::size_t histogram[buckets]{};
+    };
+
+    /**
+     * Policy recording creations to the profiler, returned by `profiler::policy()`
+     * Profiler has to outlive it
+     * Policies are called by the injector without throwing, creations which couldn't be recorded are skipped
+     */
+    class recorder {
+    public:
+        explicit recorder(const profiler& profiler) noexcept
+            : profiler_(profiler)
+        { }
+
+        template<class TArg, class TDependency, class... TCtor>
+        void operator()(const TArg&, const TDependency&, const TCtor&...) const noexcept {
+            auto& starts = recorder::starts();
+            if (starts.depth < max_depth) {
+                starts.at[starts.depth] = clock::now();
+            }
+            ++starts.depth;
+        }
+
+        template<class TArg, class TDependency>
+        void created(const TArg&, const TDependency&) const noexcept {
+            auto& starts = recorder::starts();
+            if (--starts.depth >= max_depth) {
+                return;
+            }
+
+            const auto duration = clock::now() - starts.at[starts.depth];
+            using type = typename TArg::type;
+            using scope = typename profiler_scope<type, typename TDependency::scope>::type;
+            using given = typename TDependency::given;
+            constexpr auto bytes = std::is_same<scope, scopes::unique>::value &&
+                                   std::is_same<type_traits::memory_traits_t<type>, type_traits::heap>::value ? sizeof(given) : 0;
+            profiler_.record<given, typename TArg::name, scope>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration), bytes);
+        }
+
+        template<class TArg, class TDependency>
+        void cached(const TArg&, const TDependency&) const noexcept {
+            --starts().depth;
+            using scope = typename profiler_scope<typename TArg::type, typename TDependency::scope>::type;
+            profiler_.hit<typename TDependency::given, typename TArg::name, scope>();
+        }
+
+        template<class TArg, class TDependency>
+        void failed(const TArg&, const TDependency&) const noexcept {
+            --starts().depth; // creation threw, isn't recorded
+        }
+
+    private:
+        struct starts_t { // nested creations
+            clock::time_point at[max_depth];
+            std::size_t depth = 0;
+        };
+
+        static starts_t& starts() noexcept {
+            static thread_local starts_t starts;
+            return starts;
+        }
+
+        const profiler& profiler_;
+    };
+
+    /**
+     * Name of the type recorded by the profiler, demangled when supported by the compiler
+     */
+    template<class T>
+    static std::string type_name() {
+        #if defined(__GNUC__)
+            auto status = 0;
+            std::unique_ptr<char, void(*)(void*)> name{abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status), std::free};
+            if (name && !status) {
+                return name.get();
+            }
+        #endif
+        return typeid(T).name();
+    }
+
+    /**
+     * JSON string (quoted) with `"`, `\` and control characters escaped, as written by `dump_json`
+     */
+    static std::string json_string(const std::string& value) {
+        static constexpr char hex[] = "0123456789abcdef";
+        std::string result{'"'};
+        for (const auto c : value) {
+            switch (c) {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\b': result += "\\b"; break;
+                case '\f': result += "\\f"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        result += "\\u00";
+                        result += hex[(c >> 4) & 0xf];
+                        result += hex[c & 0xf];
+                    } else {
+                        result += c;
+                    }
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    recorder policy() const noexcept {
+        return recorder{*this};
+    }
+
+    std::vector<binding> snapshot() const {
+        std::lock_guard<std::mutex> lock(data_->mutex);
+        std::vector<binding> result;
+        for (const auto& binding : data_->bindings) {
+            if (binding.count || binding.hits) {
+                result.push_back(binding);
+            }
+        }
+        return result;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(data_->mutex);
+        data_->bindings.clear();
+    }
+
+    void dump(std::ostream& os) const {
+        for (const auto& binding : snapshot()) {
+            os << binding.type << (binding.name.empty() ? "" : "[" + binding.name + "]") << " (" << binding.scope << ")"
+               << ": count=" << binding.count
+               << " hits=" << binding.hits
+               << " total=" << binding.total.count() << "ns"
+               << " p50=" << binding.percentile(0.5).count() << "ns"
+               << " p90=" << binding.percentile(0.9).count() << "ns"
+               << " p99=" << binding.percentile(0.99).count() << "ns"
+               << " max=" << binding.max.count() << "ns"
+               << " bytes=" << binding.bytes << '\n';
+        }
+    }
+
+    void dump_json(std::ostream& os) const {
+        os << '[';
+        auto separator = "";
+        for (const auto& binding : snapshot()) {
+            os << separator
+               << "{\"type\":" << json_string(binding.type) << ",\"name\":" << json_string(binding.name) << ",\"scope\":" << json_string(binding.scope)
+               << ",\"count\":" << binding.count
+               << ",\"hits\":" << binding.hits
+               << ",\"total_ns\":" << binding.total.count()
+               << ",\"p50_ns\":" << binding.percentile(0.5).count()
+               << ",\"p90_ns\":" << binding.percentile(0.9).count()
+               << ",\"p99_ns\":" << binding.percentile(0.99).count()
+               << ",\"max_ns\":" << binding.max.count()
+               << ",\"bytes\":" << binding.bytes << '}';
+            separator = ",";
+        }
+        os << ']';
+    }
+
+private:
+    struct data {
+        std::mutex mutex;
+        std::vector<binding> bindings; // indexed by `id`
+    };
+
+    static std::size_t next_id() noexcept {
+        static std::atomic<std::size_t> id{0};
+        return id++;
+    }
+
+    template<class, class, class>
+    static std::size_t id() noexcept {
+        static const auto id = next_id();
+        return id;
+    }
+
+    template<class T>
+    static std::string name(const aux::type<T>&) {
+        return type_name<T>();
+    }
+
+    static std::string name(const aux::type<no_name>&) {
+        return {};
+    }
+
+    template<class TGiven, class TName, class TScope, class TUpdate>
+    void update(const TUpdate& update) const noexcept {
+        const auto id = profiler::id<TGiven, TName, TScope>();
+        try {
+            std::lock_guard<std::mutex> lock(data_->mutex);
+            if (id >= data_->bindings.size()) {
+                data_->bindings.resize(id + 1);
+            }
+
+            auto& binding = data_->bindings[id];
+            if (binding.type.empty()) {
+                binding.type = name(aux::type<TGiven>{});
+                binding.name = name(aux::type<TName>{});
+                binding.scope = name(aux::type<TScope>{});
+            }
+            update(binding);
+        } catch (...) { } // statistics couldn't be allocated, creation isn't recorded
+    }
+
+    template<class TGiven, class TName, class TScope>
+    void hit() const noexcept {
+        update<TGiven, TName, TScope>([](binding& binding) { ++binding.hits; });
+    }
+
+    template<class TGiven, class TName, class TScope>
+    void record(std::chrono::nanoseconds duration, std::size_t bytes) const noexcept {
+        update<TGiven, TName, TScope>([=](binding& binding) { record(binding, duration, bytes); });
+    }
+
+    static void record(binding& binding, std::chrono::nanoseconds duration, std::size_t bytes) noexcept {
+        ++binding.count;
+        binding.bytes += bytes;
+        binding.total += duration;
+        binding.max = std::max(binding.max, duration);
+        auto bucket = 0;
+        while (bucket < buckets - 1 && (std::chrono::nanoseconds::rep{1} << bucket) <= duration.count()) {
+            ++bucket;
+        }
+        ++binding.histogram[bucket];
+    }
+
+    std::shared_ptr<data> data_ = std::make_shared<data>(); // copies of the profiler share statistics
+};
+
+}}}} // boost::di::v1::policies
+
+#endif
+
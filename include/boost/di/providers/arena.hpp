@@ -0,0 +1,177 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_PROVIDERS_ARENA_HPP
+#define BOOST_DI_PROVIDERS_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/concepts/creatable.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace providers {
+
+class arena {
+    template<class TResource>
+    static void* allocate_impl(void* resource, std::size_t size, std::size_t alignment) {
+        return static_cast<TResource*>(resource)->allocate(size, alignment);
+    }
+
+public:
+    /**
+     * Bump allocator over a caller supplied buffer.
+     * Falls back to chunks from the global heap when the buffer is exhausted.
+     * Memory is reclaimed only by `release`, all at once.
+     */
+    class monotonic_buffer {
+        struct chunk { chunk* next; };
+
+    public:
+        explicit monotonic_buffer(std::size_t chunk_size = 1024) noexcept
+            : next_size_(chunk_size)
+        { }
+
+        monotonic_buffer(void* buffer, std::size_t size) noexcept
+            : buffer_(static_cast<char*>(buffer))
+            , size_(size)
+            , current_(buffer_)
+            , end_(buffer_ + size)
+            , next_size_(size ? size : 1024)
+        { }
+
+        monotonic_buffer(const monotonic_buffer&) = delete;
+        monotonic_buffer& operator=(const monotonic_buffer&) = delete;
+
+        ~monotonic_buffer() noexcept {
+            release();
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment) {
+            if (auto memory = try_allocate(size, alignment)) {
+                return memory;
+            }
+            grow(size + alignment);
+            return try_allocate(size, alignment);
+        }
+
+        void deallocate(void*, std::size_t, std::size_t) noexcept { }
+
+        void release() noexcept {
+            while (chunks_) {
+                auto next = chunks_->next;
+                ::operator delete(chunks_);
+                chunks_ = next;
+            }
+            current_ = buffer_;
+            end_ = buffer_ + size_;
+        }
+
+    private:
+        void* try_allocate(std::size_t size, std::size_t alignment) noexcept {
+            void* memory = current_;
+            auto space = static_cast<std::size_t>(end_ - current_);
+            if (!current_ || !std::align(alignment, size, memory, space)) {
+                return nullptr;
+            }
+            current_ = static_cast<char*>(memory) + size;
+            return memory;
+        }
+
+        void grow(std::size_t size) {
+            next_size_ = next_size_ < size ? size : next_size_;
+            auto new_chunk = static_cast<chunk*>(::operator new(sizeof(chunk) + next_size_));
+            new_chunk->next = chunks_;
+            chunks_ = new_chunk;
+            current_ = reinterpret_cast<char*>(new_chunk + 1);
+            end_ = current_ + next_size_;
+            next_size_ *= 2;
+        }
+
+        char* buffer_ = nullptr;
+        std::size_t size_ = 0;
+        char* current_ = nullptr;
+        char* end_ = nullptr;
+        std::size_t next_size_ = 0;
+        chunk* chunks_ = nullptr;
+    };
+
+    /**
+     * Destroys the object, memory is given back when the arena is released.
+     */
+    struct deleter {
+        template<class T>
+        void operator()(T* object) const noexcept {
+            object->~T();
+        }
+    };
+
+    /**
+     * Instances kept by scopes (`shared_heap`, ex. shared, singleton) would outlive `release` of the resource,
+     * so they are not created in the arena; bind them in the parent injector (see `make_child_injector`)
+     * Objects recycled by `pooled` are kept by the pool, so the resource might be released only after the injector is gone
+     */
+    template<class TInitialization, class TMemory, class T, class... TArgs>
+    struct is_creatable {
+        static constexpr auto value =
+            concepts::creatable<TInitialization, T, TArgs...>::value &&
+            !std::is_same<TMemory, type_traits::shared_heap>::value &&
+            !std::is_same<TMemory, type_traits::local_shared_heap>::value;
+    };
+
+    /**
+     * @param resource anything with `allocate(size, alignment)`,
+     *        ex. `monotonic_buffer` or `std::pmr::memory_resource`
+     */
+    template<class TResource>
+    explicit arena(TResource& resource) noexcept
+        : resource_(&resource), allocate_(&allocate_impl<TResource>)
+    { }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::heap&
+           , TArgs&&... args) const {
+        return std::unique_ptr<T, deleter>{new (allocate<T>()) T(std::forward<TArgs>(args)...)};
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::uniform&
+           , const type_traits::heap&
+           , TArgs&&... args) const {
+        return std::unique_ptr<T, deleter>{new (allocate<T>()) T{std::forward<TArgs>(args)...}};
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::stack&
+           , TArgs&&... args) const noexcept {
+        return T(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::uniform&
+           , const type_traits::stack&
+           , TArgs&&... args) const noexcept {
+        return T{std::forward<TArgs>(args)...};
+    }
+
+private:
+    template<class T>
+    void* allocate() const {
+        return allocate_(resource_, sizeof(T), alignof(T));
+    }
+
+    void* resource_ = nullptr;
+    void* (*allocate_)(void*, std::size_t, std::size_t) = nullptr;
+};
+
+}}}} // boost::di::v1::providers
+
+#endif
+
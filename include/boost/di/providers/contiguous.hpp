@@ -0,0 +1,375 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_PROVIDERS_CONTIGUOUS_HPP
+#define BOOST_DI_PROVIDERS_CONTIGUOUS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/config.hpp"
+#include "boost/di/scopes/session.hpp"
+#include "boost/di/scopes/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+#include "boost/di/providers/stack_over_heap.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace aux {
+
+/**
+ * Reference counted block of slots, one allocation, slots start at cache line boundary
+ * Each slot is handed out once at a time, the block is released when the owner and all allocators are gone
+ */
+class contiguous_storage {
+public:
+    static constexpr std::size_t cache_line = 64;
+
+    static contiguous_storage* make(std::size_t slots, std::size_t size) {
+        const auto header = sizeof(contiguous_storage) + slots * sizeof(std::atomic<bool>);
+        auto memory = static_cast<char*>(::operator new(header + cache_line - 1 + size));
+        auto block = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(memory + header) + cache_line - 1) & ~std::uintptr_t(cache_line - 1));
+        auto storage = new (memory) contiguous_storage{block, size};
+        for (std::size_t i = 0; i < slots; ++i) {
+            new (&storage->used()[i]) std::atomic<bool>{false};
+        }
+        return storage;
+    }
+
+    void acquire() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~contiguous_storage();
+            ::operator delete(this);
+        }
+    }
+
+    /**
+     * Memory of the slot at `offset`, nullptr when the slot is already in use
+     */
+    void* allocate(std::size_t slot, std::size_t offset) noexcept {
+        if (used()[slot].exchange(true, std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return block_ + offset;
+    }
+
+    bool deallocate(std::size_t slot, const void* memory) noexcept {
+        if (!contains(memory)) {
+            return false;
+        }
+        used()[slot].store(false, std::memory_order_release);
+        return true;
+    }
+
+    bool contains(const void* memory) const noexcept {
+        return memory >= block_ && memory < block_ + size_;
+    }
+
+    const void* data() const noexcept {
+        return block_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    contiguous_storage(char* block, std::size_t size) noexcept
+        : block_(block), size_(size)
+    { }
+
+    std::atomic<bool>* used() noexcept {
+        return reinterpret_cast<std::atomic<bool>*>(this + 1);
+    }
+
+    std::atomic<std::size_t> refs_{1};
+    char* block_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+template<class T>
+struct contiguous_uniform {
+    template<class... TArgs>
+    explicit contiguous_uniform(TArgs&&... args)
+        : object{std::forward<TArgs>(args)...}
+    { }
+
+    T object;
+};
+
+} // aux
+
+namespace providers {
+
+// scopes which instances are laid out in the block
+template<class>
+struct is_contiguous_scope : std::false_type { };
+
+template<>
+struct is_contiguous_scope<scopes::shared> : std::true_type { };
+
+template<>
+struct is_contiguous_scope<scopes::shared_mt> : std::true_type { };
+
+template<class TName>
+struct is_contiguous_scope<scopes::session<TName>> : std::true_type { };
+
+template<class TName>
+struct is_contiguous_scope<scopes::session_mt<TName>> : std::true_type { };
+
+template<class T, class... Ts>
+constexpr std::size_t contiguous_index() noexcept {
+    constexpr bool same[] = {std::is_same<T, Ts>::value..., false};
+    std::size_t i = 0;
+    while (i < sizeof...(Ts) && !same[i]) {
+        ++i;
+    }
+    return i;
+}
+
+template<class, class...>
+struct contiguous_unique;
+
+template<class... Ts>
+struct contiguous_unique<aux::type_list<Ts...>> {
+    using type = aux::type_list<Ts...>;
+};
+
+template<class... Ts, class T, class... TRest>
+struct contiguous_unique<aux::type_list<Ts...>, T, TRest...>
+    : contiguous_unique<
+          std::conditional_t<contiguous_index<T, Ts...>() == sizeof...(Ts), aux::type_list<Ts..., T>, aux::type_list<Ts...>>
+        , TRest...
+      >
+{ };
+
+template<class TDependency>
+using contiguous_given_t = std::conditional_t<
+    is_contiguous_scope<typename TDependency::scope>::value
+  , aux::type_list<typename TDependency::given>
+  , aux::type_list<>
+>;
+
+template<class>
+struct contiguous_types;
+
+template<class... Ts>
+struct contiguous_types<aux::type_list<Ts...>>
+    : contiguous_unique<aux::type_list<>, Ts...>
+{ };
+
+template<class>
+struct contiguous_deps;
+
+template<class... TDeps>
+struct contiguous_deps<aux::type_list<TDeps...>>
+    : contiguous_types<aux::join_t<contiguous_given_t<TDeps>...>>
+{ };
+
+// given types of `shared` and `session` bindings of the injector, each once
+template<class TInjector>
+struct contiguous_layout : contiguous_deps<typename TInjector::deps> { };
+
+template<>
+struct contiguous_layout<void> {
+    using type = aux::type_list<>;
+};
+
+template<class TTypes>
+class contiguous;
+
+template<class... Ts>
+class contiguous<aux::type_list<Ts...>> {
+    template<class T>
+    using is_laid_out = std::integral_constant<bool, contiguous_index<T, Ts...>() != sizeof...(Ts)>;
+
+public:
+    /**
+     * Allocator of one slot, falls back to the heap when the slot is taken or too small
+     * Each copy keeps the block alive, so heap fallbacks might be released after the injector and its objects are gone
+     */
+    template<class T, std::size_t Slot>
+    class allocator {
+        template<class, std::size_t> friend class allocator;
+
+    public:
+        using value_type = T;
+
+        template<class U>
+        struct rebind {
+            using other = allocator<U, Slot>;
+        };
+
+        explicit allocator(aux::contiguous_storage* storage) noexcept
+            : storage_(storage) {
+            storage_->acquire();
+        }
+
+        allocator(const allocator& other) noexcept
+            : allocator(other.storage_)
+        { }
+
+        template<class U>
+        allocator(const allocator<U, Slot>& other) noexcept // non explicit
+            : allocator(other.storage_)
+        { }
+
+        allocator& operator=(const allocator& other) noexcept {
+            other.storage_->acquire();
+            storage_->release();
+            storage_ = other.storage_;
+            return *this;
+        }
+
+        ~allocator() noexcept {
+            storage_->release();
+        }
+
+        T* allocate(std::size_t n) {
+            // `T` is the object with its reference counter (`std::allocate_shared`), slot estimated too small would never be used
+            static_assert(sizeof(T) <= slot_size(Slot) || alignof(T) > alignof(std::max_align_t), "Reference counter doesn't fit into the estimated slot");
+            if (n * sizeof(T) <= slot_size(Slot) && alignof(T) <= alignof(std::max_align_t)) {
+                if (auto memory = storage_->allocate(Slot, offset(Slot))) {
+                    return static_cast<T*>(memory);
+                }
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* memory, std::size_t) noexcept {
+            if (!storage_->deallocate(Slot, memory)) {
+                ::operator delete(memory);
+            }
+        }
+
+        template<class U>
+        bool operator==(const allocator<U, Slot>& other) const noexcept {
+            return storage_ == other.storage_;
+        }
+
+        template<class U>
+        bool operator!=(const allocator<U, Slot>& other) const noexcept {
+            return storage_ != other.storage_;
+        }
+
+    private:
+        aux::contiguous_storage* storage_ = nullptr;
+    };
+
+    /**
+     * Object with its reference counter, space for the counter (vtable, counts and the allocator) is estimated
+     */
+    static constexpr std::size_t slot_size(std::size_t slot) noexcept {
+        constexpr std::size_t sizes[] = {sizeof(Ts) + (alignof(Ts) > sizeof(void*) ? alignof(Ts) : 0)..., 0};
+        constexpr auto counter = 3 * sizeof(void*) + sizeof(allocator<char, 0>);
+        constexpr auto alignment = alignof(std::max_align_t);
+        return (sizes[slot] + counter + alignment - 1) / alignment * alignment;
+    }
+
+    static constexpr std::size_t offset(std::size_t slot) noexcept {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < slot; ++i) {
+            result += slot_size(i);
+        }
+        return result;
+    }
+
+    static constexpr auto slots() noexcept {
+        return sizeof...(Ts);
+    }
+
+    static constexpr auto size() noexcept {
+        return offset(sizeof...(Ts));
+    }
+
+    template<class TInitialization, class TMemory, class T, class... TArgs>
+    struct is_creatable {
+        static constexpr auto value =
+            stack_over_heap::is_creatable<TInitialization, TMemory, T, TArgs...>::value;
+    };
+
+    explicit contiguous(aux::contiguous_storage* storage) noexcept
+        : storage_(storage)
+    { }
+
+    template<class TExpected, class T, class TInitialization, class TMemory, class... TArgs,
+             BOOST_DI_REQUIRES(!std::is_same<TMemory, type_traits::shared_heap>::value || !is_laid_out<T>::value)>
+    auto get(const TInitialization& initialization, const TMemory& memory, TArgs&&... args) const
+        -> decltype(stack_over_heap{}.template get<TExpected, T>(initialization, memory, std::forward<TArgs>(args)...)) {
+        return stack_over_heap{}.template get<TExpected, T>(initialization, memory, std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T, class... TArgs, BOOST_DI_REQUIRES(is_laid_out<T>::value)>
+    auto get(const type_traits::direct&, const type_traits::shared_heap&, TArgs&&... args) const {
+        return std::allocate_shared<T>(allocator<T, contiguous_index<T, Ts...>()>{storage_}, std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T, class... TArgs, BOOST_DI_REQUIRES(is_laid_out<T>::value)>
+    auto get(const type_traits::uniform&, const type_traits::shared_heap&, TArgs&&... args) const {
+        auto object = std::allocate_shared<aux::contiguous_uniform<T>>(
+            allocator<aux::contiguous_uniform<T>, contiguous_index<T, Ts...>()>{storage_}, std::forward<TArgs>(args)...
+        );
+        return std::shared_ptr<T>{object, &object->object};
+    }
+
+private:
+    aux::contiguous_storage* storage_ = nullptr;
+};
+
+} // providers
+
+// config constructing instances of `shared` and `session` bindings in one cache line aligned block of the injector
+// size of the block is computed from bindings, other objects are created by `providers::stack_over_heap`
+template<class TInjector = void>
+class contiguous_config : public config {
+    template<class T = TInjector> // injector is complete once constructed
+    using provider_t = providers::contiguous<typename providers::contiguous_layout<T>::type>;
+
+public:
+    contiguous_config()
+        : storage_(provider_t<>::slots() ? aux::contiguous_storage::make(provider_t<>::slots(), provider_t<>::size()) : nullptr)
+    { }
+
+    contiguous_config(const contiguous_config& other) noexcept
+        : config(other), storage_(other.storage_) {
+        if (storage_) {
+            storage_->acquire();
+        }
+    }
+
+    contiguous_config& operator=(const contiguous_config&) = delete;
+
+    ~contiguous_config() noexcept {
+        if (storage_) {
+            storage_->release();
+        }
+    }
+
+    auto provider() const noexcept {
+        return provider_t<>{storage_};
+    }
+
+    const aux::contiguous_storage* storage() const noexcept {
+        return storage_;
+    }
+
+private:
+    aux::contiguous_storage* storage_ = nullptr;
+};
+
+}}} // boost::di::v1
+
+#endif
+
@@ -7,7 +7,10 @@
 #ifndef BOOST_DI_PROVIDERS_HEAP_HPP
 #define BOOST_DI_PROVIDERS_HEAP_HPP
 
+#include <memory>
+#include "boost/di/local_shared_ptr.hpp"
 #include "boost/di/type_traits/ctor_traits.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 #include "boost/di/concepts/creatable.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace providers {
@@ -33,6 +36,32 @@ public:
            , TArgs&&... args) const {
         return new T{std::forward<TArgs>(args)...};
     }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::shared_heap&
+           , TArgs&&... args) const {
+        return std::make_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::shared_heap&) const {
+        return std::make_shared<T>();
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::local_shared_heap&
+           , TArgs&&... args) const {
+        return make_local_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::local_shared_heap&) const {
+        return make_local_shared<T>();
+    }
 };
 
 }}}} // boost::di::v1::providers
@@ -7,6 +7,8 @@
 #ifndef BOOST_DI_PROVIDERS_STACK_OVER_HEAP_HPP
 #define BOOST_DI_PROVIDERS_STACK_OVER_HEAP_HPP
 
+#include <memory>
+#include "boost/di/local_shared_ptr.hpp"
 #include "boost/di/type_traits/ctor_traits.hpp"
 #include "boost/di/type_traits/memory_traits.hpp"
 #include "boost/di/concepts/creatable.hpp"
@@ -35,6 +37,32 @@ public:
         return new T{std::forward<TArgs>(args)...};
     }
 
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::shared_heap&
+           , TArgs&&... args) {
+        return std::make_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::shared_heap&) {
+        return std::make_shared<T>();
+    }
+
+    template<class, class T, class... TArgs>
+    auto get(const type_traits::direct&
+           , const type_traits::local_shared_heap&
+           , TArgs&&... args) {
+        return make_local_shared<T>(std::forward<TArgs>(args)...);
+    }
+
+    template<class, class T>
+    auto get(const type_traits::uniform&
+           , const type_traits::local_shared_heap&) {
+        return make_local_shared<T>();
+    }
+
     template<class, class T, class... TArgs>
     auto get(const type_traits::direct&
            , const type_traits::stack&
@@ -22,34 +22,49 @@ public:
           , TExpected*
         >;
 
-        struct iprovider {
-            virtual ~iprovider() noexcept = default;
-            virtual TExpected* get(const type_traits::heap& = {}) const noexcept = 0;
-            virtual type get(const type_traits::stack&) const noexcept = 0;
-            virtual iprovider* clone() const noexcept = 0;
-        };
-
-        template<class TInjector>
-        class provider_impl : public iprovider {
+        /**
+         * Module injector is shared between copies of the scope and called through function pointers
+         */
+        class provider_impl {
         public:
+            template<class TInjector>
             explicit provider_impl(const TInjector& injector) noexcept
+                : provider_impl{std::make_shared<TInjector>(injector)}
+            { }
+
+            template<class TInjector>
+            explicit provider_impl(const std::shared_ptr<TInjector>& injector) noexcept
                 : injector_(injector)
+                , heap_(&get_heap<TInjector>)
+                , stack_(&get_stack<TInjector>)
             { }
 
-            TExpected* get(const type_traits::heap&) const noexcept override {
-                return injector_.create_impl(aux::type<TExpected*>{});
+            TExpected* get(const type_traits::heap& = {}) const noexcept {
+                return heap_(injector_.get());
             }
 
-            type get(const type_traits::stack&) const noexcept override {
-                return injector_.create_impl(aux::type<type>{});
+            type get(const type_traits::stack&) const noexcept {
+                return stack_(injector_.get());
             }
 
-            iprovider* clone() const noexcept override {
-                return new provider_impl(*this); // non-ownership pointer
+            std::shared_ptr<TExpected> get(const type_traits::shared_heap&) const noexcept {
+                return std::shared_ptr<TExpected>{get(type_traits::heap{})};
             }
 
         private:
-            TInjector injector_;
+            template<class TInjector>
+            static TExpected* get_heap(const void* injector) noexcept {
+                return static_cast<const TInjector*>(injector)->create_impl(aux::type<TExpected*>{});
+            }
+
+            template<class TInjector>
+            static type get_stack(const void* injector) noexcept {
+                return static_cast<const TInjector*>(injector)->create_impl(aux::type<type>{});
+            }
+
+            std::shared_ptr<const void> injector_;
+            TExpected* (*heap_)(const void*) = nullptr;
+            type (*stack_)(const void*) = nullptr;
         };
 
     public:
@@ -58,11 +73,19 @@ public:
 
         template<class TInjector>
         explicit scope(const TInjector& injector) noexcept
-            : provider_{new provider_impl<TInjector>(injector)}
+            : provider_{injector}
+        { }
+
+        /**
+         * Module state shared with other types exposed by the same injector
+         */
+        template<class TInjector>
+        explicit scope(const std::shared_ptr<TInjector>& injector) noexcept
+            : provider_{injector}
         { }
 
         explicit scope(const scope& other) noexcept
-            : provider_(other.provider_->clone())
+            : provider_(other.provider_)
         { }
 
         template<class T, class TProvider>
@@ -70,23 +93,15 @@ public:
 
         template<class T, class TProvider>
         auto create(const TProvider&) {
-            return scope_.template create<T>(*provider_);
+            return scope_.template create<T>(provider_);
         }
 
     private:
-        std::unique_ptr<iprovider> provider_;
+        provider_impl provider_;
         typename TScope::template scope<TExpected, TGiven> scope_;
     };
 };
 
-#if defined(BOOST_DI_GCC)
-    template<class TScope>
-    template<class TExpected, class TGiven>
-    TExpected* exposed<TScope>::scope<TExpected, TGiven>::iprovider::get(const type_traits::heap&) const noexcept {
-        return nullptr;
-    }
-#endif
-
 }}}} // boost::di::v1::scopes
 
 #endif
@@ -23,19 +23,32 @@ class external {
 public:
     template<class TExpected, class, class = void>
     struct scope {
+        /**
+         * Move-only objects can't be copied per creation, they are injected by reference instead
+         */
+        using wrapper = std::conditional_t<
+            std::is_copy_constructible<TExpected>::value
+          , wrappers::unique<TExpected>
+          , wrappers::shared<TExpected&>
+        >;
+
         template<class>
-        using is_referable = std::false_type;
+        using is_referable = std::integral_constant<bool, !std::is_copy_constructible<TExpected>::value>;
 
         explicit scope(const TExpected& object)
             : object_{object}
         { }
 
+        explicit scope(TExpected&& object)
+            : object_{std::move(object)}
+        { }
+
         template<class, class TProvider>
-        TExpected try_create(const TProvider&);
+        wrapper try_create(const TProvider&);
 
         template<class, class TProvider>
-        auto create(const TProvider&) const noexcept {
-            return wrappers::unique<TExpected>{object_};
+        auto create(const TProvider&) noexcept {
+            return wrapper{object_};
         }
 
         TExpected object_;
@@ -73,6 +86,10 @@ public:
             : object_{object}
         { }
 
+        explicit scope(std::shared_ptr<TGiven>&& object)
+            : object_{std::move(object)}
+        { }
+
         template<class, class TProvider>
         wrappers::shared<TGiven> try_create(const TProvider&);
 
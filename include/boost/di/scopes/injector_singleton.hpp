@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_INJECTOR_SINGLETON_HPP
+#define BOOST_DI_SCOPES_INJECTOR_SINGLETON_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+namespace scopes {
+
+class injector_singleton {
+public:
+    /**
+     * Storage of one binding, owned by the injector
+     * Copy of the injector shares instances which were already created
+     */
+    template<class TExpected, class T, class TName>
+    struct slot {
+        slot() noexcept { }
+
+        slot(const slot& other) noexcept {
+            if (other.is_created.load(std::memory_order_acquire)) {
+                object = other.object;
+                is_created.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<bool> is_created{false};
+        std::once_flag once;
+        std::shared_ptr<T> object;
+    };
+
+    template<class TExpected, class T>
+    class scope {
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        wrappers::shared<T> create(const TProvider& provider) { // slot is only available from the injector
+            auto& slot = core::injector_access::slot<injector_singleton::slot<TExpected, T, typename TProvider::name>>(provider.injector_);
+            if (BOOST_DI_UNLIKELY(!slot.is_created.load(std::memory_order_acquire))) {
+                create_once(slot, provider);
+            }
+            return wrappers::shared<T>{slot.object};
+        }
+
+    private:
+        template<class TSlot, class TProvider>
+        static void create_once(TSlot& slot, const TProvider& provider) {
+            std::call_once(slot.once, [&slot, &provider] {
+                slot.object = std::shared_ptr<T>{provider.get(type_traits::shared_heap{})};
+                slot.is_created.store(true, std::memory_order_release);
+            });
+        }
+    };
+};
+
+} // scopes
+
+constexpr scopes::injector_singleton injector_singleton{};
+
+}}} // boost::di::v1
+
+#endif
+
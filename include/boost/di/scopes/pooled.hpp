@@ -0,0 +1,396 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_POOLED_HPP
+#define BOOST_DI_SCOPES_POOLED_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+// returns the object to the pool it was taken from, objects which weren't taken from a pool are deleted
+// pooled object is kept as it was taken from the pool, `T` might be its base (virtual one as well), which can't be cast back
+template<class T>
+struct pooled_deleter {
+    void operator()(T* object) const noexcept {
+        if (release) {
+            release(pool, pooled);
+        } else {
+            delete object;
+        }
+    }
+
+    void (*release)(void*, void*) = nullptr;
+    void* pool = nullptr;
+    void* pooled = nullptr;
+};
+
+template<class T>
+using pooled_ptr = std::unique_ptr<T, pooled_deleter<T>>;
+
+struct pool_stats {
+    double hit_ratio() const noexcept {
+        return hits + misses ? double(hits) / (hits + misses) : 0.0;
+    }
+
+    std::size_t hits = 0; // objects taken from the pool
+    std::size_t misses = 0; // objects created by the provider
+    std::size_t drops = 0; // returned objects deleted, because the pool was full
+};
+
+namespace scopes {
+
+struct no_reset {
+    template<class T>
+    void operator()(T&) const noexcept { }
+};
+
+template<class TReset = no_reset, std::size_t Capacity = 64, std::size_t ThreadCapacity = 16>
+class pooled {
+    /**
+     * Objects of one scope (binding of the injector and its copies), kept alive by the scope, objects created by it
+     * and the thread bound to it
+     * Each thread keeps up to `ThreadCapacity` objects of the last pool it used without locking,
+     * `Capacity` objects are shared between threads
+     */
+    template<class T>
+    class pool {
+        struct thread_cache;
+
+        struct stats_registry { // stats of all pools of `T`
+            std::mutex mutex;
+            std::vector<thread_cache*> caches;
+            pool_stats retired; // stats of finished threads
+        };
+
+        struct thread_cache {
+            thread_cache() {
+                auto& registry = pool::registry();
+                std::lock_guard<std::mutex> lock{registry.mutex};
+                registry.caches.push_back(this);
+            }
+
+            ~thread_cache() noexcept {
+                is_destroyed() = true;
+                unbind();
+                auto& registry = pool::registry();
+                std::lock_guard<std::mutex> lock{registry.mutex};
+                registry.retired.hits += hits.load(std::memory_order_relaxed);
+                registry.retired.misses += misses.load(std::memory_order_relaxed);
+                registry.retired.drops += drops.load(std::memory_order_relaxed);
+                registry.caches.erase(std::find(registry.caches.begin(), registry.caches.end(), this));
+            }
+
+            void bind(pool* object) noexcept {
+                unbind();
+                object->refs_.fetch_add(1, std::memory_order_relaxed);
+                owner = object;
+            }
+
+            void unbind() noexcept {
+                if (auto object = owner) {
+                    owner = nullptr;
+                    const auto dropped = object->give_back(objects, size);
+                    size = 0;
+                    increment(drops, dropped);
+                    object->release_ref();
+                }
+            }
+
+            pool* owner = nullptr;
+            T* objects[ThreadCapacity ? ThreadCapacity : 1];
+            std::size_t size = 0;
+            std::atomic<std::size_t> hits{0}; // written by the owning thread only
+            std::atomic<std::size_t> misses{0};
+            std::atomic<std::size_t> drops{0};
+        };
+
+    public:
+        using destroy_t = void (*)(T*);
+
+        /**
+         * Objects are destroyed the way the provider would destroy them
+         */
+        static T* take(T* object, destroy_t& destroy) noexcept {
+            destroy = &destroy_object<std::default_delete<T>>;
+            return object;
+        }
+
+        template<class TDeleter>
+        static T* take(std::unique_ptr<T, TDeleter> object, destroy_t& destroy) noexcept {
+            static_assert(std::is_empty<TDeleter>::value && std::is_default_constructible<TDeleter>::value, "Deleter of pooled objects has to be stateless");
+            destroy = &destroy_object<TDeleter>;
+            return object.release();
+        }
+
+        pool() {
+            objects_.reserve(Capacity);
+        }
+
+        pool(const pool&) = delete;
+        pool& operator=(const pool&) = delete;
+
+        void attach() noexcept { // copy of the scope
+            scopes_.fetch_add(1, std::memory_order_relaxed);
+            refs_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void detach() noexcept {
+            if (scopes_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                close();
+            }
+            release_ref();
+        }
+
+        template<class TProvider>
+        T* acquire(const TProvider& provider) {
+            auto& cache = pool::cache();
+            if (BOOST_DI_LIKELY(cache.owner == this && cache.size != 0)) {
+                increment(cache.hits);
+                return cache.objects[--cache.size];
+            }
+
+            if (cache.owner != this) {
+                cache.bind(this);
+            }
+
+            if (auto object = refill(cache)) {
+                increment(cache.hits);
+                return object;
+            }
+
+            increment(cache.misses);
+            destroy_t destroy = nullptr;
+            auto object = take(provider.get(type_traits::heap{}), destroy);
+            destroy_.store(destroy, std::memory_order_relaxed);
+            refs_.fetch_add(1, std::memory_order_relaxed);
+            return object;
+        }
+
+        static void release(void* owner, void* object) noexcept {
+            static_cast<pool*>(owner)->release(static_cast<T*>(object));
+        }
+
+        void release(T* object) noexcept {
+            if (BOOST_DI_UNLIKELY(closed_.load(std::memory_order_acquire))) {
+                destroy(&object, 1);
+                return;
+            }
+
+            TReset{}(*object);
+
+            if (BOOST_DI_UNLIKELY(is_destroyed())) { // object released at thread exit
+                give_back(&object, 1);
+                return;
+            }
+
+            auto& cache = pool::cache();
+            if (BOOST_DI_UNLIKELY(cache.owner != this)) { // object taken by another thread
+                increment(cache.drops, give_back(&object, 1));
+                return;
+            }
+
+            if (BOOST_DI_UNLIKELY(cache.size == ThreadCapacity)) {
+                const auto half = (ThreadCapacity + 1) / 2;
+                cache.size -= half;
+                increment(cache.drops, give_back(cache.objects + cache.size, half));
+            }
+
+            if (ThreadCapacity) {
+                cache.objects[cache.size++] = object;
+            } else {
+                increment(cache.drops, give_back(&object, 1));
+            }
+        }
+
+        static pool_stats stats() {
+            auto& registry = pool::registry();
+            std::lock_guard<std::mutex> lock{registry.mutex};
+            auto result = registry.retired;
+            for (auto cache : registry.caches) {
+                result.hits += cache->hits.load(std::memory_order_relaxed);
+                result.misses += cache->misses.load(std::memory_order_relaxed);
+                result.drops += cache->drops.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+    private:
+        static stats_registry& registry() {
+            static stats_registry registry;
+            return registry;
+        }
+
+        static thread_cache& cache() {
+            static thread_local thread_cache cache;
+            return cache;
+        }
+
+        static bool& is_destroyed() noexcept { // cache of the calling thread
+            static thread_local bool flag = false;
+            return flag;
+        }
+
+        static void increment(std::atomic<std::size_t>& counter, std::size_t value = 1) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        template<class TDeleter>
+        static void destroy_object(T* object) noexcept {
+            TDeleter{}(object);
+        }
+
+        T* refill(thread_cache& cache) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (objects_.empty()) {
+                return nullptr;
+            }
+
+            const auto count = std::min(objects_.size(), std::max<std::size_t>(ThreadCapacity / 2, 1));
+            for (auto i = count - 1; i > 0; --i) {
+                cache.objects[cache.size++] = objects_.back();
+                objects_.pop_back();
+            }
+
+            auto object = objects_.back();
+            objects_.pop_back();
+            return object;
+        }
+
+        /**
+         * Moves objects to the shared list, objects which don't fit are destroyed
+         * Returns number of destroyed objects
+         */
+        std::size_t give_back(T* const* objects, std::size_t size) noexcept {
+            std::size_t kept = 0;
+            {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!closed_.load(std::memory_order_relaxed)) {
+                kept = std::min(size, Capacity - objects_.size());
+                objects_.insert(objects_.end(), objects, objects + kept);
+            }
+            }
+            destroy(objects + kept, size - kept);
+            return size - kept;
+        }
+
+        /**
+         * Called once the last copy of the scope is gone, objects returned afterwards are destroyed straight away
+         * Objects cached by other threads are destroyed once they use another pool of `T` or exit
+         */
+        void close() noexcept {
+            if (!is_destroyed() && cache().owner == this) {
+                cache().unbind();
+            }
+
+            std::vector<T*> objects;
+            {
+            std::lock_guard<std::mutex> lock{mutex_};
+            closed_.store(true, std::memory_order_release);
+            objects.swap(objects_);
+            }
+            destroy(objects.data(), objects.size());
+        }
+
+        void destroy(T* const* objects, std::size_t size) noexcept { // releases references of objects, might delete the pool
+            const auto destroy_object = destroy_.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < size; ++i) {
+                destroy_object(objects[i]);
+            }
+            release_ref(size);
+        }
+
+        void release_ref(std::size_t count = 1) noexcept {
+            if (count && refs_.fetch_sub(count, std::memory_order_acq_rel) == count) {
+                delete this;
+            }
+        }
+
+        std::atomic<std::size_t> scopes_{1};
+        std::atomic<std::size_t> refs_{1}; // scopes, objects and bound threads
+        std::atomic<bool> closed_{false};
+        std::atomic<destroy_t> destroy_{nullptr};
+        std::mutex mutex_;
+        std::vector<T*> objects_;
+    };
+
+    template<class T>
+    struct wrapper {
+        template<class I>
+        inline operator pooled_ptr<I>() const noexcept {
+            return pooled_ptr<I>{object, pooled_deleter<I>{&pool<T>::release, owner, object}};
+        }
+
+        template<class I>
+        inline operator std::shared_ptr<I>() const noexcept {
+            return {object, pooled_deleter<I>{&pool<T>::release, owner, object}};
+        }
+
+        T* object = nullptr;
+        pool<T>* owner = nullptr;
+    };
+
+public:
+    template<class, class T>
+    class scope {
+    public:
+        template<class>
+        using is_referable = std::false_type;
+
+        scope()
+            : pool_(new pool<T>{})
+        { }
+
+        scope(const scope& other) noexcept
+            : pool_(other.pool_) {
+            pool_->attach();
+        }
+
+        scope& operator=(const scope&) = delete;
+
+        ~scope() noexcept {
+            pool_->detach();
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider) const
+            -> decltype(wrapper<T>{pool<T>::take(provider.get(type_traits::heap{}), std::declval<typename pool<T>::destroy_t&>())});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) const {
+            return wrapper<T>{pool_->acquire(provider), pool_};
+        }
+
+    private:
+        pool<T>* pool_ = nullptr;
+    };
+
+    /**
+     * Stats of objects of the given type, summed over all pools and threads
+     */
+    template<class T>
+    static pool_stats stats() {
+        return pool<T>::stats();
+    }
+};
+
+} // scopes
+
+constexpr scopes::pooled<> pooled{};
+
+}}} // boost::di::v1
+
+#endif
+
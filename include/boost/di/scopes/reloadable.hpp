@@ -0,0 +1,159 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_RELOADABLE_HPP
+#define BOOST_DI_SCOPES_RELOADABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+namespace scopes {
+
+// replaces the instance of reloadable bindings of `T`, empty `object` recreates it through the binding on the next use
+template<class T>
+struct reload {
+    std::shared_ptr<T> object;
+};
+
+class reloadable {
+public:
+    /**
+     * Keeps one instance which might be replaced at any time by `reload<TExpected>`
+     * Readers never lock, they announce themselves in the counter of the current epoch whilst copying the instance,
+     * the writer publishes the new instance, starts the next epoch and waits only for readers of the previous one
+     * before releasing the old instance, which is destroyed when the last snapshot handed out is released
+     */
+    template<class TExpected, class T>
+    class scope {
+    public:
+        template<class>
+        using is_referable = std::false_type; // instance might be replaced, snapshots only
+
+        scope() noexcept { }
+
+        scope(const scope& other) noexcept
+            : stale_(other.stale_.load()) {
+            if (auto object = other.object_.load()) {
+                object_.store(new std::shared_ptr<TExpected>{*object});
+            }
+        }
+
+        ~scope() noexcept {
+            delete object_.load();
+        }
+
+        void call(const reload<TExpected>& action) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (action.object) {
+                replace(new std::shared_ptr<TExpected>{action.object});
+                stale_.store(false, std::memory_order_release);
+            } else {
+                stale_.store(object_.load(std::memory_order_relaxed) != nullptr, std::memory_order_release);
+            }
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<TExpected, false>{std::shared_ptr<TExpected>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            if (BOOST_DI_UNLIKELY(stale_.load(std::memory_order_acquire))) {
+                recreate(provider);
+            }
+
+            const auto epoch = enter();
+            auto object = object_.load();
+            if (BOOST_DI_LIKELY(object != nullptr)) {
+                std::shared_ptr<TExpected> result{*object};
+                leave(epoch);
+                return wrappers::shared<TExpected, false>{result};
+            }
+            leave(epoch);
+            return wrappers::shared<TExpected, false>{create_impl(provider)};
+        }
+
+    private:
+        std::size_t enter() noexcept {
+            for (;;) {
+                const auto epoch = epoch_.load();
+                readers_[epoch & 1].fetch_add(1);
+                if (BOOST_DI_LIKELY(epoch_.load() == epoch)) {
+                    return epoch & 1;
+                }
+                leave(epoch & 1); // writer started the next epoch in the meantime
+            }
+        }
+
+        void leave(std::size_t epoch) noexcept {
+            readers_[epoch].fetch_sub(1, std::memory_order_release);
+        }
+
+        void replace(std::shared_ptr<TExpected>* object) noexcept { // `mutex_` has to be locked
+            auto old = object_.exchange(object);
+            const auto epoch = epoch_.fetch_add(1);
+            // seq_cst, as the epoch and the counters of readers (see `enter`), otherwise a reader of the old instance might be missed
+            while (readers_[epoch & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+            delete old;
+        }
+
+        /**
+         * Only one reader recreates the stale instance, the others take the current one meanwhile
+         */
+        template<class TProvider>
+        void recreate(const TProvider& provider) {
+            if (!mutex_.try_lock()) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock{mutex_, std::adopt_lock};
+            if (stale_.load(std::memory_order_relaxed)) {
+                replace(new std::shared_ptr<TExpected>{provider.get(type_traits::shared_heap{})});
+                stale_.store(false, std::memory_order_release);
+            }
+        }
+
+        template<class TProvider>
+        std::shared_ptr<TExpected> create_impl(const TProvider& provider) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (auto object = object_.load(std::memory_order_relaxed)) {
+                return *object;
+            }
+            auto object = new std::shared_ptr<TExpected>{provider.get(type_traits::shared_heap{})};
+            object_.store(object);
+            return *object;
+        }
+
+        std::atomic<std::shared_ptr<TExpected>*> object_{nullptr};
+        std::atomic<std::size_t> epoch_{0};
+        std::atomic<int> readers_[2] = {{0}, {0}};
+        std::atomic<bool> stale_{false};
+        std::mutex mutex_;
+    };
+};
+
+} // scopes
+
+constexpr scopes::reloadable reloadable{};
+
+template<class T>
+inline auto reload(std::shared_ptr<T> object = {}) noexcept {
+    return scopes::reload<T>{std::move(object)};
+}
+
+}}} // boost::di::v1
+
+#endif
+
@@ -7,9 +7,14 @@
 #ifndef BOOST_DI_SCOPES_SESSION_HPP
 #define BOOST_DI_SCOPES_SESSION_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 #include "boost/di/fwd.hpp" // no_name
 
 namespace boost { namespace di { inline namespace v1 { namespace scopes {
@@ -26,8 +31,9 @@ public:
     template<class, class T>
     class scope {
     public:
+        // instance is reset by `session_exit`, so `const std::shared_ptr<T>&` parameters get a copy instead of referring to it
         template<class T_>
-        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+        using is_referable = typename wrappers::shared<T, false, wrappers::shared_object_t<T>>::template is_referable<T_>;
 
         void call(const session_entry<TName>&) noexcept {
             in_scope_ = true;
@@ -40,22 +46,151 @@ public:
 
         template<class, class TProvider>
         auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            -> decltype(wrappers::shared<T, false, wrappers::shared_object_t<T>>{wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})}});
 
         template<class, class TProvider>
         auto create(const TProvider& provider) {
             if (BOOST_DI_LIKELY(in_scope_) && BOOST_DI_UNLIKELY(!object_)) {
-                object_ = std::shared_ptr<T>{provider.get()};
+                object_ = wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})};
             }
-            return wrappers::shared<T>{object_};
+            return wrappers::shared<T, false, wrappers::shared_object_t<T>>{object_};
         }
 
     private:
-        std::shared_ptr<T> object_;
+        wrappers::shared_object_t<T> object_;
         bool in_scope_ = false;
     };
 };
 
+template<class TName = no_name>
+class session_mt {
+public:
+    /**
+     * Thread-safe version of session scope
+     * Readers never lock, they announce themselves in the counter of the current epoch whilst copying the instance,
+     * `session_exit` starts the next epoch under the lock, then, without holding it, waits only for readers of the previous one before releasing the instance
+     * `session_exit` calls are serialized until the end of the wait, so that two of them never release instances of overlapping epochs
+     */
+    template<class, class T>
+    class scope {
+        // instance owned by the scope, published to readers by its address
+        class atomic_object {
+        public:
+            using object_t = std::unique_ptr<std::shared_ptr<T>>;
+
+            atomic_object() noexcept { }
+            atomic_object(const atomic_object&) = delete;
+            atomic_object& operator=(const atomic_object&) = delete;
+
+            ~atomic_object() noexcept {
+                exchange(nullptr);
+            }
+
+            std::shared_ptr<T>* load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return object_.load(order);
+            }
+
+            object_t exchange(object_t object) noexcept {
+                return object_t{object_.exchange(object.release())};
+            }
+
+        private:
+            std::atomic<std::shared_ptr<T>*> object_{nullptr};
+        };
+
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T, false>::template is_referable<T_>;
+
+        scope() noexcept { }
+
+        scope(const scope& other) {
+            std::lock_guard<std::mutex> lock{other.mutex_};
+            in_scope_.store(other.in_scope_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            if (auto object = other.object_.load(std::memory_order_relaxed)) {
+                object_.exchange(std::make_unique<std::shared_ptr<T>>(*object));
+            }
+        }
+
+        void call(const session_entry<TName>&) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            in_scope_.store(true, std::memory_order_relaxed);
+        }
+
+        void call(const session_exit<TName>&) {
+            std::lock_guard<std::mutex> exit_lock{exit_mutex_}; // held until readers of the previous epoch left
+            typename atomic_object::object_t object; // released once readers of the previous epoch left
+            auto epoch = std::size_t{0};
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                in_scope_.store(false, std::memory_order_relaxed);
+                object = object_.exchange(nullptr);
+                epoch = epoch_.fetch_add(1);
+            }
+            // not under the lock, so that `session_entry` and creation of the next instance don't wait for readers
+            // seq_cst, as the epoch and the counters of readers (see `enter`), otherwise a reader of the old instance might be missed
+            while (readers_[epoch & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T, false>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            const auto epoch = enter();
+            auto object = object_.load();
+            if (BOOST_DI_LIKELY(object != nullptr)) {
+                std::shared_ptr<T> result{*object};
+                leave(epoch);
+                return wrappers::shared<T, false>{result};
+            }
+            leave(epoch);
+            return wrappers::shared<T, false>{create_impl(provider)};
+        }
+
+    private:
+        std::size_t enter() noexcept {
+            for (;;) {
+                const auto epoch = epoch_.load();
+                readers_[epoch & 1].fetch_add(1);
+                if (BOOST_DI_LIKELY(epoch_.load() == epoch)) {
+                    return epoch & 1;
+                }
+                leave(epoch & 1); // `session_exit` started the next epoch in the meantime
+            }
+        }
+
+        void leave(std::size_t epoch) noexcept {
+            readers_[epoch].fetch_sub(1, std::memory_order_release);
+        }
+
+        template<class TProvider>
+        std::shared_ptr<T> create_impl(const TProvider& provider) {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!in_scope_.load(std::memory_order_relaxed)) {
+                return {};
+            }
+            if (auto object = object_.load(std::memory_order_relaxed)) {
+                return *object;
+            }
+            auto object = std::make_unique<std::shared_ptr<T>>(provider.get(type_traits::shared_heap{}));
+            std::shared_ptr<T> result{*object};
+            object_.exchange(std::move(object));
+            return result;
+        }
+
+        atomic_object object_;
+        std::atomic<std::size_t> epoch_{0};
+        std::atomic<int> readers_[2] = {{0}, {0}};
+        mutable std::mutex mutex_;
+        std::mutex exit_mutex_;
+        std::atomic<bool> in_scope_{false};
+    };
+};
+
 }}}} // boost::di::v1::scopes
 
 #endif
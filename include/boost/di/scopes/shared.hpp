@@ -7,9 +7,12 @@
 #ifndef BOOST_DI_SCOPES_SHARED_HPP
 #define BOOST_DI_SCOPES_SHARED_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace scopes {
 
@@ -19,22 +22,66 @@ public:
     class scope {
     public:
         template<class T_>
-        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+        using is_referable = typename wrappers::shared<T, true, wrappers::shared_object_t<T>>::template is_referable<T_>;
 
         template<class, class TProvider>
         auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            -> decltype(wrappers::shared<T, true, wrappers::shared_object_t<T>>{wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})}});
 
         template<class, class TProvider>
         auto create(const TProvider& provider) {
             if (BOOST_DI_UNLIKELY(!object_)) {
-                object_ = std::shared_ptr<T>{provider.get()};
+                object_ = wrappers::shared_object_t<T>{provider.get(wrappers::shared_memory_t{})};
+            }
+            return wrappers::shared<T, true, wrappers::shared_object_t<T>>{object_};
+        }
+
+    private:
+        wrappers::shared_object_t<T> object_;
+    };
+};
+
+class shared_mt {
+public:
+    /**
+     * Thread-safe version of shared scope
+     * Instance is published once and never changes afterwards, so readers don't lock
+     */
+    template<class, class T>
+    class scope {
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+
+        scope() noexcept { }
+
+        scope(const scope& other) noexcept {
+            if (other.is_created_.load(std::memory_order_acquire)) {
+                object_ = other.object_;
+                is_created_.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            if (BOOST_DI_UNLIKELY(!is_created_.load(std::memory_order_acquire))) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (!object_) {
+                    object_ = std::shared_ptr<T>{provider.get(type_traits::shared_heap{})};
+                    is_created_.store(true, std::memory_order_release);
+                }
             }
             return wrappers::shared<T>{object_};
         }
 
     private:
         std::shared_ptr<T> object_;
+        std::atomic<bool> is_created_{false};
+        std::mutex mutex_;
     };
 };
 
@@ -7,9 +7,12 @@
 #ifndef BOOST_DI_SCOPES_SINGLETON_HPP
 #define BOOST_DI_SCOPES_SINGLETON_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace scopes {
 
@@ -17,30 +20,47 @@ class singleton {
 public:
     template<class, class T>
     class scope {
+        /**
+         * Constant initialized, so neither the fast path nor the first access pays a guard check
+         */
+        struct instance {
+            std::atomic<bool> is_created{false};
+            std::once_flag once;
+            std::shared_ptr<T> object;
+        };
+
     public:
         template<class T_>
         using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
 
         template<class, class TProvider>
         auto try_create(const TProvider& provider)
-            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get()}});
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
 
         template<class, class TProvider>
         auto create(const TProvider& provider) {
-            if (BOOST_DI_UNLIKELY(!get_instance())) {
-                get_instance() = std::shared_ptr<T>{provider.get()};
+            if (BOOST_DI_UNLIKELY(!instance_.is_created.load(std::memory_order_acquire))) {
+                create_once(provider);
             }
-            return wrappers::shared<T>{get_instance()};
+            return wrappers::shared<T>{instance_.object};
         }
 
     private:
-        static std::shared_ptr<T>& get_instance() noexcept {
-            static std::shared_ptr<T> object;
-            return object;
+        template<class TProvider>
+        static void create_once(const TProvider& provider) {
+            std::call_once(instance_.once, [&provider] {
+                instance_.object = std::shared_ptr<T>{provider.get(type_traits::shared_heap{})};
+                instance_.is_created.store(true, std::memory_order_release);
+            });
         }
+
+        static instance instance_;
     };
 };
 
+template<class TExpected, class T>
+typename singleton::scope<TExpected, T>::instance singleton::scope<TExpected, T>::instance_{};
+
 }}}} // boost::di::v1::scopes
 
 #endif
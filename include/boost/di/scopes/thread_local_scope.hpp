@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_SCOPES_THREAD_LOCAL_SCOPE_HPP
+#define BOOST_DI_SCOPES_THREAD_LOCAL_SCOPE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/wrappers/shared.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+namespace scopes {
+
+class thread_local_scope {
+public:
+    template<class, class T>
+    class scope {
+        struct objects;
+
+        /**
+         * Registered for destruction only after the object (and therefore its dependencies) was created,
+         * so that it's destroyed at thread exit before anything it depends on
+         */
+        struct thread {
+            ~thread() noexcept {
+                for (auto& registered : scopes) {
+                    if (auto instances = registered.lock()) {
+                        instances->erase(key());
+                    }
+                }
+            }
+
+            std::vector<std::weak_ptr<objects>> scopes;
+        };
+
+        // instances of the scope per thread, released at thread exit or with the last copy of the scope
+        struct objects {
+            struct instance {
+                const void* thread;
+                std::shared_ptr<T> object;
+            };
+
+            std::shared_ptr<T>* find(const void* thread) {
+                std::lock_guard<std::mutex> lock{mutex};
+                auto it = find_impl(thread);
+                return it != instances.end() ? &(*it)->object : nullptr;
+            }
+
+            std::shared_ptr<T>& emplace(const void* thread, std::shared_ptr<T> object) {
+                std::unique_ptr<instance> node{new instance{thread, std::move(object)}}; // address is kept by the thread
+                std::lock_guard<std::mutex> lock{mutex};
+                instances.push_back(std::move(node));
+                return instances.back()->object;
+            }
+
+            void erase(const void* thread) {
+                std::unique_ptr<instance> node; // destroyed outside of the lock
+                std::lock_guard<std::mutex> lock{mutex};
+                auto it = find_impl(thread);
+                if (it != instances.end()) {
+                    node = std::move(*it);
+                    instances.erase(it);
+                }
+            }
+
+            auto find_impl(const void* thread) {
+                return std::find_if(instances.begin(), instances.end(), [thread](const auto& node) { return node->thread == thread; });
+            }
+
+            const std::size_t id = next_id();
+            std::mutex mutex;
+            std::vector<std::unique_ptr<instance>> instances;
+        };
+
+        // instances of the last scopes used by the thread, ids are never reused
+        struct cache {
+            static constexpr std::size_t size = 4;
+
+            struct entry {
+                std::size_t id = 0;
+                std::shared_ptr<T>* object = nullptr;
+            };
+
+            std::shared_ptr<T>* find(std::size_t id) noexcept {
+                for (auto& cached : entries) {
+                    if (cached.id == id) {
+                        return cached.object;
+                    }
+                }
+                return nullptr;
+            }
+
+            std::shared_ptr<T>* emplace(std::size_t id, std::shared_ptr<T>& object) noexcept {
+                auto& cached = entries[next++ % size];
+                cached.id = id;
+                cached.object = &object;
+                return cached.object;
+            }
+
+            entry entries[size];
+            std::size_t next = 0;
+        };
+
+    public:
+        template<class T_>
+        using is_referable = typename wrappers::shared<T>::template is_referable<T_>;
+
+        scope()
+            : objects_(std::make_shared<objects>())
+        { }
+
+        template<class, class TProvider>
+        auto try_create(const TProvider& provider)
+            -> decltype(wrappers::shared<T>{std::shared_ptr<T>{provider.get(type_traits::shared_heap{})}});
+
+        template<class, class TProvider>
+        auto create(const TProvider& provider) {
+            auto& cached = get_cache();
+            auto object = cached.find(objects_->id);
+            if (BOOST_DI_UNLIKELY(!object)) {
+                object = cached.emplace(objects_->id, create_impl(provider));
+            }
+            return wrappers::shared<T>{*object};
+        }
+
+    private:
+        template<class TProvider>
+        std::shared_ptr<T>& create_impl(const TProvider& provider) {
+            if (auto object = objects_->find(key())) {
+                return *object;
+            }
+            std::shared_ptr<T> object{provider.get(type_traits::shared_heap{})};
+            auto& scopes = get_thread().scopes;
+            scopes.erase(std::remove_if(scopes.begin(), scopes.end(), [](const auto& registered) { return registered.expired(); }), scopes.end());
+            scopes.push_back(objects_);
+            return objects_->emplace(key(), std::move(object));
+        }
+
+        // unique for each running thread, trivial so that it's available during thread exit
+        static const void* key() noexcept {
+            static thread_local const char object = 0;
+            return &object;
+        }
+
+        static std::size_t next_id() noexcept {
+            static std::atomic<std::size_t> id{0};
+            return ++id;
+        }
+
+        static thread& get_thread() noexcept {
+            static thread_local thread object;
+            return object;
+        }
+
+        static cache& get_cache() noexcept {
+            static thread_local cache object;
+            return object;
+        }
+
+        std::shared_ptr<objects> objects_;
+    };
+};
+
+} // scopes
+
+constexpr scopes::thread_local_scope thread_local_scope{};
+
+}}} // boost::di::v1
+
+#endif
+
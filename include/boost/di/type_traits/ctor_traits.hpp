@@ -7,6 +7,7 @@
 #ifndef BOOST_DI_TYPE_TRAITS_CTOR_TRAITS_HPP
 #define BOOST_DI_TYPE_TRAITS_CTOR_TRAITS_HPP
 
+#include <new>
 #include "boost/di/aux_/compiler_specific.hpp"
 #include "boost/di/aux_/type_traits.hpp"
 #include "boost/di/aux_/utility.hpp"
@@ -30,48 +31,83 @@ struct get {
 template<class T, std::size_t N>
 using get_t = typename get<T, N>::type;
 
-template<template<class...> class, class, class, class = void>
+template<std::size_t N>
+struct ctor_priority : ctor_priority<N - 1> { };
+
+template<>
+struct ctor_priority<0> { };
+
+// `args` overloads for each number of constructor arguments, instantiated once for all types.
+// Single overload resolution of `args<T>(ctor_priority<2 * limit>{})` picks the longest constructor
+// (any_type_fwd before any_type_ref_fwd) without class template instantiations per arity.
+// Direct constructors are probed with a new-expression, `T(arg)` would be a functional cast.
+template<class, class>
 struct ctor_impl;
 
-template<template<class...> class TIsConstructible, class T, std::size_t... TArgs>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<TArgs...>
-    , BOOST_DI_REQUIRES_T((sizeof...(TArgs) > 0) && !TIsConstructible<T, get_t<core::any_type_fwd<T>, TArgs>...>::value)>
-    : std::conditional<
-           TIsConstructible<T, get_t<core::any_type_ref_fwd<T>, TArgs>...>::value
-         , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>
-         , typename ctor_impl<
-               TIsConstructible
-             , T
-             , std::make_index_sequence<sizeof...(TArgs) - 1>
-           >::type
-      >
-{ };
+struct ctor_impl_default {
+    template<class>
+    static aux::type_list<> args(const ctor_priority<0>&);
+};
 
-template<template<class...> class TIsConstructible, class T, std::size_t... TArgs>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<TArgs...>,
-      BOOST_DI_REQUIRES_T((sizeof...(TArgs) > 0) && TIsConstructible<T, get_t<core::any_type_fwd<T>, TArgs>...>::value)>
-    : aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>
+template<>
+struct ctor_impl<direct, std::index_sequence<>>
+    : ctor_impl_default
 { };
 
-template<template<class...> class TIsConstructible, class T>
-struct ctor_impl<TIsConstructible, T, std::index_sequence<>>
-    : aux::type_list<>
+template<>
+struct ctor_impl<uniform, std::index_sequence<>>
+    : ctor_impl_default
 { };
 
-template<template<class...> class TIsConstructible, class T>
-using ctor_impl_t =
-    typename ctor_impl<
-        TIsConstructible
-      , T
-      , std::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>
-    >::type;
+template<std::size_t... TArgs>
+struct ctor_impl<direct, std::index_sequence<TArgs...>>
+    : ctor_impl<direct, std::make_index_sequence<sizeof...(TArgs) - 1>> {
+    using ctor_impl<direct, std::make_index_sequence<sizeof...(TArgs) - 1>>::args;
+
+    template<class T>
+    static decltype(
+        void(::new T(std::declval<get_t<core::any_type_fwd<T>, TArgs>>()...))
+      , aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2>&);
+
+    template<class T>
+    static decltype(
+        void(::new T(std::declval<get_t<core::any_type_ref_fwd<T>, TArgs>>()...))
+      , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2 - 1>&);
+};
+
+template<std::size_t... TArgs>
+struct ctor_impl<uniform, std::index_sequence<TArgs...>>
+    : ctor_impl<uniform, std::make_index_sequence<sizeof...(TArgs) - 1>> {
+    using ctor_impl<uniform, std::make_index_sequence<sizeof...(TArgs) - 1>>::args;
+
+    template<class T>
+    static decltype(
+        void(T{std::declval<get_t<core::any_type_fwd<T>, TArgs>>()...})
+      , aux::type_list<get_t<core::any_type_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2>&);
+
+    template<class T>
+    static decltype(
+        void(T{std::declval<get_t<core::any_type_ref_fwd<T>, TArgs>>()...})
+      , aux::type_list<get_t<core::any_type_ref_fwd<T>, TArgs>...>{}
+    ) args(const ctor_priority<sizeof...(TArgs) * 2 - 1>&);
+};
+
+template<class TInitialization, class T>
+using ctor_impl_t = decltype(
+    ctor_impl<TInitialization, std::make_index_sequence<BOOST_DI_CFG_CTOR_LIMIT_SIZE>>::template args<T>(
+        ctor_priority<BOOST_DI_CFG_CTOR_LIMIT_SIZE * 2>{}
+    )
+);
 
 template<class...>
 struct ctor;
 
 template<class T>
 struct ctor<T, aux::type_list<>>
-    : aux::pair<uniform, ctor_impl_t<aux::is_braces_constructible, T>>
+    : aux::pair<uniform, ctor_impl_t<uniform, T>>
 { };
 
 template<class T, class... TArgs>
@@ -83,7 +119,7 @@ struct ctor<T, aux::type_list<TArgs...>>
 
 template<class T>
 struct ctor_traits
-    : type_traits::ctor<T, type_traits::ctor_impl_t<std::is_constructible, T>>
+    : type_traits::ctor<T, type_traits::ctor_impl_t<type_traits::direct, T>>
 { };
 
 namespace type_traits {
@@ -15,6 +15,8 @@ namespace boost { namespace di { inline namespace v1 { namespace type_traits {
 
 struct stack { };
 struct heap { };
+struct shared_heap { }; // heap, object and its reference counter in one allocation
+struct local_shared_heap { }; // heap, object and its reference counters (see `local_shared_ptr`) in one allocation
 
 template<class T, class = void>
 struct memory_traits {
@@ -91,6 +93,16 @@ struct memory_traits<const std::weak_ptr<T>&> {
     using type = heap;
 };
 
+template<class T>
+struct memory_traits<local_shared_ptr<T>> {
+    using type = heap;
+};
+
+template<class T>
+struct memory_traits<const local_shared_ptr<T>&> {
+    using type = heap;
+};
+
 template<class T>
 struct memory_traits<T, std::enable_if_t<std::is_polymorphic<T>::value>> {
     using type = heap;
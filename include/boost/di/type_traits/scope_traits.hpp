@@ -89,6 +89,16 @@ struct scope_traits<const std::weak_ptr<T>&> {
     using type = scopes::singleton;
 };
 
+template<class T>
+struct scope_traits<local_shared_ptr<T>> {
+    using type = scopes::singleton;
+};
+
+template<class T>
+struct scope_traits<const local_shared_ptr<T>&> {
+    using type = scopes::singleton;
+};
+
 template<class T>
 using scope_traits_t = typename scope_traits<T>::type;
 
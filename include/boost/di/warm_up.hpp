@@ -0,0 +1,335 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_WARM_UP_HPP
+#define BOOST_DI_WARM_UP_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "boost/di/aux_/utility.hpp"
+#include "boost/di/async.hpp"
+#include "boost/di/core/binder.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/lazy.hpp"
+#include "boost/di/scopes/external.hpp"
+#include "boost/di/scopes/shared.hpp"
+#include "boost/di/scopes/singleton.hpp"
+#include "boost/di/type_traits/ctor_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+namespace core {
+
+// scopes keeping one instance are warmed up, `type` tells whether the instance might be created concurrently
+template<class>
+struct warm_up_traits {
+    using type = aux::none_type;
+};
+
+template<>
+struct warm_up_traits<scopes::shared> {
+    using type = std::false_type;
+};
+
+template<>
+struct warm_up_traits<scopes::shared_mt> {
+    using type = std::true_type;
+};
+
+template<>
+struct warm_up_traits<scopes::singleton> {
+    using type = std::true_type;
+};
+
+template<>
+struct warm_up_traits<scopes::injector_singleton> {
+    using type = std::true_type;
+};
+
+template<>
+struct warm_up_traits<scopes::reloadable> {
+    using type = std::true_type;
+};
+
+template<class TDependency>
+struct warm_up_binding {
+    using expected = typename TDependency::expected;
+    using given = typename TDependency::given;
+    using name = typename TDependency::name;
+    using scope = typename TDependency::scope;
+};
+
+// threads taking tasks of `warm_up_impl`, created once and reused for every level of bindings
+// exception thrown by a task stops taking tasks of its level and is rethrown on the calling thread by `run`
+class warm_up_workers {
+public:
+    explicit warm_up_workers(std::size_t threads) {
+        try {
+            for (auto i = std::size_t{1}; i < threads; ++i) {
+                workers_.emplace_back([this] { work(); });
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    warm_up_workers(const warm_up_workers&) = delete;
+    warm_up_workers& operator=(const warm_up_workers&) = delete;
+
+    ~warm_up_workers() noexcept {
+        stop();
+    }
+
+    // calls `task(i)` for each `i` in [begin, end) using workers and the calling thread, returns once all of them are done
+    template<class TTask>
+    void run(const TTask& task, std::size_t begin, std::size_t end) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            task_ = &task;
+            call_ = [](const void* task, std::size_t i) { (*static_cast<const TTask*>(task))(i); };
+            next_ = begin;
+            end_ = end;
+            busy_ = workers_.size();
+            ++level_;
+        }
+        wake_.notify_all();
+        take(); // calling thread takes tasks as well
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        idle_.wait(lock, [this] { return !busy_; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    void take() noexcept {
+        for (auto i = next_++; i < end_ && !failed_; i = next_++) {
+            try {
+                call_(task_, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                failed_ = true;
+            }
+        }
+    }
+
+    void work() noexcept {
+        for (auto level = std::size_t{0};;) {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                wake_.wait(lock, [&] { return done_ || level != level_; });
+                if (done_) {
+                    return;
+                }
+                level = level_;
+            }
+            take();
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                --busy_;
+            }
+            idle_.notify_one();
+        }
+    }
+
+    void stop() noexcept {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            done_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : workers_) {
+            thread.join();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    const void* task_ = nullptr;
+    void (*call_)(const void*, std::size_t) = nullptr;
+    std::atomic<std::size_t> next_{0};
+    std::size_t end_ = 0;
+    std::size_t busy_ = 0;
+    std::size_t level_ = 0;
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+    bool done_ = false;
+    std::vector<std::thread> workers_;
+};
+
+// length of the longest chain of constructors in the object graph of `T`, graph has to be known (see `is_async_safe`)
+template<class TDeps, class T, class TName = no_name>
+struct warm_up_depth;
+
+inline constexpr std::size_t warm_up_max() noexcept {
+    return 0;
+}
+
+template<class... Ts>
+inline constexpr std::size_t warm_up_max(std::size_t value, Ts... values) noexcept {
+    const auto max = warm_up_max(values...);
+    return value > max ? value : max;
+}
+
+template<class TDeps, class TCtor>
+struct warm_up_depth_ctor : std::integral_constant<std::size_t, 0> { };
+
+template<class TDeps, class TInitialization, class... TCtor>
+struct warm_up_depth_ctor<TDeps, aux::pair<TInitialization, aux::type_list<TCtor...>>>
+    : std::integral_constant<std::size_t, 1 + warm_up_max(warm_up_depth<TDeps, TCtor>::value...)>
+{ };
+
+template<class TDeps, class TDependency, class TScope>
+struct warm_up_depth_scope
+    : warm_up_depth_ctor<TDeps, typename type_traits::ctor_traits<typename TDependency::given>::type>
+{ };
+
+template<class TDeps, class TDependency>
+struct warm_up_depth_scope<TDeps, TDependency, scopes::external> : std::integral_constant<std::size_t, 0> { };
+
+template<class TDeps, class T, class TName>
+struct warm_up_depth {
+    using dependency = std::remove_reference_t<binder::resolve_t<TDeps, T, TName>>;
+    static constexpr auto value = warm_up_depth_scope<TDeps, dependency, typename dependency::scope>::value;
+};
+
+template<class TDeps, class T, class TName, class TName_>
+struct warm_up_depth<TDeps, type_traits::named<TName, T>, TName_> : warm_up_depth<TDeps, T, TName> { };
+
+template<class TDeps, class T, class TThreadSafe, class TName>
+struct warm_up_depth<TDeps, lazy<T, TThreadSafe>, TName> : std::integral_constant<std::size_t, 0> { };
+
+// how the instance of the binding is created, `aux::none_type` - it's not, `std::false_type` - on the calling thread, `std::true_type` - in parallel
+template<class TInjector, class TDependency, class TIsThreadSafe, bool /*creatable and not overridden*/>
+struct warm_up_kind_impl {
+    using type = aux::none_type;
+};
+
+template<class TInjector, class TDependency>
+struct warm_up_kind_impl<TInjector, TDependency, std::false_type, true> {
+    using type = std::false_type;
+};
+
+// whole object graph has to be safe to be created concurrently, otherwise it's created on the calling thread
+template<class TInjector, class TDependency>
+struct warm_up_kind_impl<TInjector, TDependency, std::true_type, true> {
+    using type = std::integral_constant<bool,
+        is_async_safe<TInjector, std::shared_ptr<typename TDependency::expected>, typename TDependency::name>::value
+    >;
+};
+
+template<class TInjector, class TDependency, class TIsThreadSafe = typename warm_up_traits<typename TDependency::scope>::type>
+struct warm_up_kind
+    : warm_up_kind_impl<TInjector, TDependency, TIsThreadSafe,
+          injector_access::is_creatable<TInjector, std::shared_ptr<typename TDependency::expected>, typename TDependency::name>::value &&
+          std::is_same<binder::resolve_t<TInjector, typename TDependency::expected, typename TDependency::name>, TDependency&>::value
+      >
+{ };
+
+template<class TInjector, class TDependency>
+struct warm_up_kind<TInjector, TDependency, aux::none_type> {
+    using type = aux::none_type;
+};
+
+template<class, class, class>
+struct warm_up_dependencies;
+
+template<class TInjector, class... Ts, class TKind>
+struct warm_up_dependencies<TInjector, aux::type_list<Ts...>, TKind> {
+    using type = aux::join_t<
+        std::conditional_t<std::is_same<typename warm_up_kind<TInjector, Ts>::type, TKind>::value, aux::type_list<Ts>, aux::type_list<>>...
+    >;
+};
+
+template<class TInjector, class TDependency>
+inline std::chrono::nanoseconds warm_up_create(const TInjector& injector) {
+    using clock = std::chrono::steady_clock;
+    using type = type_traits::named<typename TDependency::name, std::shared_ptr<typename TDependency::expected>>;
+    const auto start = clock::now();
+    injector_access::create<std::true_type, std::false_type>(injector, aux::type<type>{});
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+}
+
+template<class TInjector, class TReporter, class... TParallel, class... TSequential>
+inline void warm_up_impl(const TInjector& injector, const TReporter& reporter, std::size_t threads
+                       , const aux::type_list<TParallel...>&, const aux::type_list<TSequential...>&) {
+    using task_t = std::chrono::nanoseconds (*)(const TInjector&);
+    constexpr auto parallel = sizeof...(TParallel);
+    constexpr auto size = parallel + sizeof...(TSequential);
+    const task_t tasks[size + 1] = {&warm_up_create<TInjector, TParallel>..., &warm_up_create<TInjector, TSequential>..., nullptr};
+    const std::size_t depths[parallel + 1] = {
+        warm_up_depth<TInjector, std::shared_ptr<typename TParallel::expected>, typename TParallel::name>::value..., 0
+    };
+    std::chrono::nanoseconds durations[size + 1]{};
+
+    // bindings with the same depth don't depend on each other, so they are created together once their dependencies are
+    std::size_t order[parallel + 1]{};
+    std::iota(order, order + parallel, std::size_t{0});
+    std::stable_sort(order, order + parallel, [&](auto lhs, auto rhs) { return depths[lhs] < depths[rhs]; });
+    if (parallel) {
+        warm_up_workers workers{std::min(threads, parallel)};
+        const auto task = [&](std::size_t i) { durations[order[i]] = tasks[order[i]](injector); };
+        for (auto begin = std::size_t{0}, end = std::size_t{0}; begin < parallel; begin = end) {
+            for (end = begin + 1; end < parallel && depths[order[end]] == depths[order[begin]]; ++end);
+            workers.run(task, begin, end);
+        }
+    }
+
+    for (auto i = parallel; i < size; ++i) {
+        durations[i] = tasks[i](injector);
+    }
+
+    auto i = std::size_t{0};
+    int _[]{0, (reporter(warm_up_binding<TParallel>{}, durations[i++]), 0)..., (reporter(warm_up_binding<TSequential>{}, durations[i++]), 0)...}; (void)_;
+}
+
+/**
+ * Creates instances of scopes keeping them (shared, shared_mt, singleton, injector_singleton, reloadable) up front, see `injector::warm_up`
+ * Bindings of thread-safe scopes with object graphs safe to be created concurrently (see `is_async_safe`) are created by `threads` threads,
+ * in dependency order (bindings of the same depth in parallel), the others (ex. `shared` or depending on `shared`) afterwards, on the calling thread
+ * Exception thrown by a constructor stops the warm-up and is rethrown on the calling thread, once all threads are done
+ * `reporter(binding, std::chrono::nanoseconds)` (binding provides `expected`, `given`, `name` and `scope` types) is called for each binding afterwards, on the calling thread
+ */
+template<class TConfig, class TPolicies, class... TDeps, class TReporter, class TThreads = std::size_t>
+inline void warm_up_injector(const injector<TConfig, TPolicies, TDeps...>& injector_, const TReporter& reporter
+                           , const TThreads& threads = std::thread::hardware_concurrency()) { // deduced, so that it's preferred to the fallback of `boost/di/core/injector.hpp`
+    using injector_t = injector<TConfig, TPolicies, TDeps...>;
+    using deps = typename injector_t::deps;
+    warm_up_impl(
+        injector_
+      , reporter
+      , static_cast<std::size_t>(threads)
+      , typename warm_up_dependencies<injector_t, deps, std::true_type>::type{}
+      , typename warm_up_dependencies<injector_t, deps, std::false_type>::type{}
+    );
+}
+
+template<class TConfig, class TPolicies, class... TDeps>
+inline void warm_up_injector(const injector<TConfig, TPolicies, TDeps...>& injector_) {
+    warm_up_injector(injector_, [](const auto&, const auto&) { });
+}
+
+} // core
+
+}}} // boost::di::v1
+
+#endif
+
@@ -10,10 +10,41 @@
 #include <memory>
 #include "boost/di/aux_/utility.hpp"
 #include "boost/di/fwd.hpp" // boost::shared_ptr
+#include "boost/di/local_shared_ptr.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace wrappers {
 
-template<class T, bool Ref = true>
+// instance kept by `shared` and `session` scopes, created from the provider with `shared_memory_t`
+#if defined(BOOST_DI_CFG_LOCAL_SHARED_PTR) // single-threaded, `local_shared_ptr` parameters don't touch atomic counters
+    template<class T>
+    struct shared_object : std::shared_ptr<T> { // `const std::shared_ptr<T>&` parameters are passed without copying it
+        shared_object() noexcept { }
+
+        explicit shared_object(local_shared_ptr<T> object) noexcept
+            : std::shared_ptr<T>{object.to_shared_ptr()}, local{std::move(object)}
+        { }
+
+        void reset() noexcept {
+            std::shared_ptr<T>::reset();
+            local.reset();
+        }
+
+        local_shared_ptr<T> local;
+    };
+
+    template<class T>
+    using shared_object_t = shared_object<T>;
+
+    using shared_memory_t = type_traits::local_shared_heap;
+#else
+    template<class T>
+    using shared_object_t = std::shared_ptr<T>;
+
+    using shared_memory_t = type_traits::shared_heap;
+#endif
+
+template<class T, bool Ref = true, class TObject = std::shared_ptr<std::remove_reference_t<T>>>
 struct shared {
     using type = std::conditional_t<std::is_same<T, void>::value, _, T>;
 
@@ -27,9 +58,43 @@ struct shared {
         : std::false_type
     { };
 
+    template<class I>
+    struct is_referable<local_shared_ptr<I>>
+        : std::false_type
+    { };
+
+    template<class I>
+    struct is_referable<const std::shared_ptr<I>&> // kept instance is passed without copying it
+        : std::integral_constant<bool, Ref && std::is_base_of<std::shared_ptr<I>, TObject>::value>
+    { };
+
+    template<class I>
+    struct is_referable<const local_shared_ptr<I>&> // copy doesn't touch atomic counters
+        : std::false_type
+    { };
+
+    static const std::shared_ptr<T>& to_shared_ptr(const std::shared_ptr<T>& sp) noexcept {
+        return sp;
+    }
+
+    static local_shared_ptr<T> to_local_shared_ptr(const std::shared_ptr<T>& sp) {
+        return local_shared_ptr<T>{sp}; // allocates the counter
+    }
+
+    #if defined(BOOST_DI_CFG_LOCAL_SHARED_PTR)
+        static const local_shared_ptr<T>& to_local_shared_ptr(const shared_object<T>& object) noexcept {
+            return object.local;
+        }
+    #endif
+
     template<class I>
     inline operator std::shared_ptr<I>() const noexcept {
-        return object;
+        return to_shared_ptr(object);
+    }
+
+    template<class I>
+    inline operator local_shared_ptr<I>() const {
+        return to_local_shared_ptr(object);
     }
 
     template<class TSharedPtr>
@@ -43,16 +108,21 @@ struct shared {
 
     template<class I>
     inline operator boost::shared_ptr<I>() const noexcept {
+        const auto& shared_object = to_shared_ptr(object);
         using sp = sp_holder<boost::shared_ptr<T>>;
-        if (auto* deleter = std::get_deleter<sp, T>(object)) {
+        if (auto* deleter = std::get_deleter<sp, T>(shared_object)) {
             return deleter->object;
         } else {
-            return {object.get(), sp_holder<std::shared_ptr<T>>{object}};
+            return {shared_object.get(), sp_holder<std::shared_ptr<T>>{shared_object}};
         }
     }
 
     template<class I>
     inline operator std::weak_ptr<I>() const noexcept {
+        return to_shared_ptr(object);
+    }
+
+    inline operator const TObject&() const noexcept {
         return object;
     }
 
@@ -64,7 +134,7 @@ struct shared {
         return *object;
     }
 
-    std::conditional_t<Ref, const std::shared_ptr<T>&, std::shared_ptr<T>> object;
+    std::conditional_t<Ref, const TObject&, TObject> object;
 };
 
 template<class T>
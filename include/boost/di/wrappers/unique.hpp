@@ -9,7 +9,9 @@
 
 #include <memory>
 #include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/aux_/type_traits.hpp"
 #include "boost/di/fwd.hpp"
+#include "boost/di/local_shared_ptr.hpp"
 
 namespace boost { namespace di { inline namespace v1 { namespace wrappers {
 
@@ -54,6 +56,11 @@ struct unique<T*> {
         return boost::shared_ptr<I>{object};
     }
 
+    template<class I>
+    inline operator local_shared_ptr<I>() const {
+        return local_shared_ptr<I>{std::unique_ptr<I>{object}};
+    }
+
     template<class I>
     inline operator std::unique_ptr<I>() const noexcept {
         return std::unique_ptr<I>{object};
@@ -68,19 +75,20 @@ struct unique<T*> {
     T* object = nullptr;
 };
 
+// ownership of objects with custom deleter (ex. `providers::arena`) can't be transferred by raw pointer
 template<class T, class TDeleter>
 struct unique<std::unique_ptr<T, TDeleter>> {
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(std::is_convertible<const T&, I>::value)>
     inline operator I() const noexcept {
         return *object;
     }
 
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(aux::always<I>::value && std::is_same<TDeleter, std::default_delete<T>>::value)>
     inline operator I*() noexcept {
         return object.release();
     }
 
-    template<class I>
+    template<class I, BOOST_DI_REQUIRES(aux::always<I>::value && std::is_same<TDeleter, std::default_delete<T>>::value)>
     inline operator const I*() noexcept {
         return object.release();
     }
@@ -95,7 +103,12 @@ struct unique<std::unique_ptr<T, TDeleter>> {
         return {object.release(), object.get_deleter()};
     }
 
-    template<class I, class D>
+    template<class I>
+    inline operator local_shared_ptr<I>() {
+        return local_shared_ptr<I>{std::move(object)};
+    }
+
+    template<class I, class D, BOOST_DI_REQUIRES(std::is_convertible<TDeleter, D>::value)>
     inline operator std::unique_ptr<I, D>() noexcept {
         return std::move(object);
     }
@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_COMMON_ALLOCATIONS_HPP
+#define BOOST_DI_COMMON_ALLOCATIONS_HPP
+
+#include <cstdlib>
+#include <new>
+#include "common/do_not_optimize.hpp"
+
+/**
+ * Tests and benchmarks are single translation unit programs,
+ * global allocation functions are replaced to count allocations per thread
+ */
+inline std::size_t& allocations() noexcept {
+    static thread_local std::size_t allocations = 0;
+    return allocations;
+}
+
+#if defined(__GNUC__)
+    #define ALLOCATIONS_NOINLINE __attribute__((noinline)) // malloc/free are not visible to the mismatched new/delete analysis
+#else
+    #define ALLOCATIONS_NOINLINE
+#endif
+
+ALLOCATIONS_NOINLINE void* operator new(std::size_t size) {
+    ++allocations();
+    if (auto ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+ALLOCATIONS_NOINLINE void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+ALLOCATIONS_NOINLINE void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+/**
+ * Heap allocations made by the calling thread whilst `f` was running
+ * Objects created by `f` have to be passed to `do_not_optimize`, otherwise their allocations might be elided
+ */
+template<class F>
+inline std::size_t allocations_of(const F& f) {
+    const auto before = allocations();
+    f();
+    return allocations() - before;
+}
+
+#endif
+
@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_BENCHMARK_HPP
+#define BOOST_DI_BENCHMARK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "common/do_not_optimize.hpp"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * Allocations are reported by benchmarks including `common/allocations.hpp` (replacing global `operator new`) before this header
+ */
+#if defined(BOOST_DI_COMMON_ALLOCATIONS_HPP)
+    #define BENCHMARK_ALLOCATIONS() static_cast<long long>(allocations())
+#else
+    #define BENCHMARK_ALLOCATIONS() -1ll
+#endif
+
+#if !defined(BENCHMARK_ITERATIONS)
+    #define BENCHMARK_ITERATIONS 1000000
+#endif
+
+/**
+ * Hardware event (ex. retired instructions, cache misses) of the calling thread, not available (-1) when perf events are not accessible
+ */
+class perf_counter {
+public:
+    explicit perf_counter(unsigned long long event) noexcept {
+        #if defined(__linux__)
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = event;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        #else
+            (void)event;
+        #endif
+    }
+
+    perf_counter(const perf_counter&) = delete;
+    perf_counter& operator=(const perf_counter&) = delete;
+
+    ~perf_counter() noexcept {
+        #if defined(__linux__)
+            if (fd_ != -1) {
+                close(fd_);
+            }
+        #endif
+    }
+
+    void start() noexcept {
+        #if defined(__linux__)
+            if (fd_ != -1) {
+                ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        #endif
+    }
+
+    long long stop() noexcept {
+        long long count = -1;
+        #if defined(__linux__)
+            if (fd_ != -1) {
+                ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+                if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+                    count = -1;
+                }
+            }
+        #endif
+        return count;
+    }
+
+private:
+    int fd_ = -1;
+};
+
+#if defined(__linux__)
+    #define BENCHMARK_INSTRUCTIONS PERF_COUNT_HW_INSTRUCTIONS
+    #define BENCHMARK_CACHE_MISSES PERF_COUNT_HW_CACHE_MISSES
+#else
+    #define BENCHMARK_INSTRUCTIONS 0
+    #define BENCHMARK_CACHE_MISSES 0
+#endif
+
+struct benchmark_result {
+    double ns_per_op = 0.0;
+    double allocations_per_op = -1.0;
+    double instructions_per_op = -1.0;
+    double cache_misses_per_op = -1.0; // last level cache
+};
+
+/**
+ * JSON object per line when BENCHMARK_FORMAT=json (or BENCHMARK_FORMAT_JSON is defined), text otherwise
+ */
+inline bool benchmark_json() noexcept {
+    static const auto json = [] {
+        auto format = std::getenv("BENCHMARK_FORMAT");
+        #if defined(BENCHMARK_FORMAT_JSON)
+            return !format || !std::strcmp(format, "json");
+        #else
+            return format && !std::strcmp(format, "json");
+        #endif
+    }();
+    return json;
+}
+
+inline void report(const char* name, const benchmark_result& result) {
+    if (benchmark_json()) {
+        std::printf("{\"name\": \"%s\", \"ns_per_op\": %.3f, \"allocations_per_op\": ", name, result.ns_per_op);
+        result.allocations_per_op < 0 ? std::printf("null") : std::printf("%.3f", result.allocations_per_op);
+        std::printf(", \"instructions_per_op\": ");
+        result.instructions_per_op < 0 ? std::printf("null") : std::printf("%.1f", result.instructions_per_op);
+        std::printf(", \"cache_misses_per_op\": ");
+        result.cache_misses_per_op < 0 ? std::printf("null}\n") : std::printf("%.3f}\n", result.cache_misses_per_op);
+        return;
+    }
+
+    std::printf("%-56s %12.2f ns/op", name, result.ns_per_op);
+    if (result.allocations_per_op >= 0) {
+        std::printf(" %8.2f allocs/op", result.allocations_per_op);
+    }
+    if (result.instructions_per_op >= 0) {
+        std::printf(" %10.1f instructions/op", result.instructions_per_op);
+    }
+    result.cache_misses_per_op < 0 ? std::printf("\n") : std::printf(" %8.3f cache misses/op\n", result.cache_misses_per_op);
+}
+
+template<class TFunction>
+inline benchmark_result measure(const TFunction& function, std::size_t iterations = BENCHMARK_ITERATIONS) {
+    using clock = std::chrono::steady_clock;
+    static perf_counter instructions{BENCHMARK_INSTRUCTIONS};
+    static perf_counter cache_misses{BENCHMARK_CACHE_MISSES};
+    benchmark_result result;
+
+    const auto allocations_before = BENCHMARK_ALLOCATIONS();
+    instructions.start();
+    cache_misses.start();
+    const auto start = clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        function();
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    const auto misses = cache_misses.stop();
+    const auto count = instructions.stop();
+
+    result.ns_per_op = ns / iterations;
+    result.allocations_per_op = allocations_before < 0 ? -1.0 : double(BENCHMARK_ALLOCATIONS() - allocations_before) / iterations;
+    result.instructions_per_op = count < 0 ? -1.0 : double(count) / iterations;
+    result.cache_misses_per_op = misses < 0 ? -1.0 : double(misses) / iterations;
+    return result;
+}
+
+template<class TFunction>
+inline double benchmark(const char* name, const TFunction& function, std::size_t iterations = BENCHMARK_ITERATIONS) {
+    const auto result = measure(function, iterations);
+    report(name, result);
+    return result.ns_per_op;
+}
+
+template<class TFunction>
+inline double benchmark_threads(const char* name, std::size_t threads, const TFunction& function, std::size_t iterations = BENCHMARK_ITERATIONS) {
+    using clock = std::chrono::steady_clock;
+    std::atomic<bool> ready{false};
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            while (!ready.load(std::memory_order_acquire)) { }
+            for (std::size_t i = 0; i < iterations; ++i) {
+                function();
+            }
+        });
+    }
+    const auto start = clock::now();
+    ready.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / iterations;
+    if (benchmark_json()) {
+        std::printf("{\"name\": \"%s\", \"threads\": %zu, \"ns_per_op\": %.3f}\n", name, threads, ns);
+    } else {
+        std::printf("%-40s x%-6zu %12.2f ns/op\n", name, threads, ns);
+    }
+    return ns;
+}
+
+#endif
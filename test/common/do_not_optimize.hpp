@@ -0,0 +1,20 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_DI_COMMON_DO_NOT_OPTIMIZE_HPP
+#define BOOST_DI_COMMON_DO_NOT_OPTIMIZE_HPP
+
+template<class T>
+inline void do_not_optimize(T&& value) {
+    #if defined(_MSC_VER)
+        volatile auto ptr = &value; (void)ptr;
+    #else
+        asm volatile("" : : "g"(&value) : "memory");
+    #endif
+}
+
+#endif
+
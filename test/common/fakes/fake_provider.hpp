@@ -24,6 +24,11 @@ struct fake_provider {
         return T{};
     }
 
+    std::shared_ptr<T> get(const type_traits::shared_heap&) const noexcept {
+        ++provide_calls();
+        return std::make_shared<T>();
+    }
+
     static int& provide_calls() {
         static int calls = 0;
         return calls;
@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <cstddef>
+#include <memory>
+#include "common/allocations.hpp"
+#include "boost/di.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "boost/di/allocations.hpp"
+#include "boost/di/providers/arena.hpp"
+#include "boost/di/providers/heap.hpp"
+#include "boost/di/warm_up.hpp"
+
+namespace di = boost::di;
+
+auto name = []{};
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+
+struct leaf {
+    BOOST_DI_INJECT(leaf, int i)
+        : i(i)
+    { }
+
+    int i = 0;
+};
+
+struct values {
+    BOOST_DI_INJECT(values, int i, (named = name) double d, leaf l)
+        : i(i), d(d), l(l)
+    { }
+
+    int i = 0;
+    double d = 0.0;
+    leaf l;
+};
+
+struct pointers {
+    BOOST_DI_INJECT(pointers, std::unique_ptr<i1> i, std::shared_ptr<leaf> s, values v)
+        : i(std::move(i)), s(s), v(v)
+    { }
+
+    std::unique_ptr<i1> i;
+    std::shared_ptr<leaf> s;
+    values v;
+};
+
+struct lazy_pointers {
+    BOOST_DI_INJECT(lazy_pointers, di::lazy<std::unique_ptr<i1>> i, (named = name) di::lazy<std::shared_ptr<leaf>> s)
+        : i(std::move(i)), s(std::move(s))
+    { }
+
+    di::lazy<std::unique_ptr<i1>> i;
+    di::lazy<std::shared_ptr<leaf>> s;
+};
+
+struct deduced {
+    deduced(int, leaf, const values&) { }
+};
+
+template<class T, class TInjector>
+void expect_allocations(std::size_t expected, const TInjector& injector) {
+    expect_eq(expected, allocations_of([&] {
+        auto object = injector.template create<T>();
+        do_not_optimize(object);
+    }));
+}
+
+test stack_over_heap_values_dont_allocate = [] {
+    auto injector = di::make_injector(
+        di::bind<int>().to(42)
+      , di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), values>(), "");
+    expect_allocations<values>(0, injector);
+    expect_allocations<leaf>(0, injector);
+    expect_eq(42, injector.create<values>().l.i);
+};
+
+test heap_allocations_of_unique_scope = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<leaf>().in(di::unique)
+      , di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<i1>>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), i1*>(), "");
+    static_assert(2 == di::allocations_for<decltype(injector), std::shared_ptr<leaf>>(), "");
+    static_assert(3 == di::allocations_for<decltype(injector), pointers>(), "");
+
+    expect_allocations<std::unique_ptr<i1>>(1, injector);
+    expect_allocations<std::shared_ptr<leaf>>(2, injector);
+    expect_allocations<pointers>(3, injector);
+    delete injector.create<i1*>();
+};
+
+test scopes_keeping_instances_dont_allocate_once_created = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::injector_singleton)
+      , di::bind<leaf>().in(di::shared)
+      , di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), std::shared_ptr<i1>>(), "");
+    static_assert(0 == di::allocations_for<decltype(injector), std::shared_ptr<leaf>>(), "");
+    static_assert(0 == di::allocations_for<decltype(injector), const leaf&>(), "");
+
+    injector.warm_up();
+    expect_allocations<std::shared_ptr<i1>>(0, injector);
+    expect_allocations<std::shared_ptr<leaf>>(0, injector);
+    expect_allocations<const leaf&>(0, injector);
+};
+
+test external_bindings_dont_allocate = [] {
+    auto object = std::make_shared<impl1>();
+    auto injector = di::make_injector(
+        di::bind<i1>().to(object)
+      , di::bind<int>().to(42)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), std::shared_ptr<i1>>(), "");
+    static_assert(0 == di::allocations_for<decltype(injector), int>(), "");
+    expect_allocations<std::shared_ptr<i1>>(0, injector);
+    expect_allocations<int>(0, injector);
+};
+
+test lazy_dependencies_dont_allocate_until_used = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<leaf>().named(name).in(di::unique)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), lazy_pointers>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<lazy_pointers>>(), "");
+    expect_allocations<lazy_pointers>(0, injector);
+
+    auto object = injector.create<lazy_pointers>();
+    expect_eq(1u, allocations_of([&] { object.i.get(); }));
+    expect_eq(2u, allocations_of([&] { object.s.get(); }));
+};
+
+test deduced_constructors_dont_allocate_on_stack = [] {
+    auto injector = di::make_injector(
+        di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), deduced>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<deduced>>(), "");
+    static_assert(!di::allocations_known<decltype(injector), deduced>(), "");
+    static_assert(di::allocations_known<decltype(injector), values>(), "");
+
+    expect_allocations<deduced>(0, injector);
+    expect_allocations<std::unique_ptr<deduced>>(1, injector);
+};
+
+class config_heap : public di::config {
+public:
+    auto provider() const noexcept {
+        return di::providers::heap{};
+    }
+};
+
+test heap_provider_allocates_values = [] {
+    auto injector = di::make_injector<config_heap>(
+        di::bind<leaf>().in(di::unique)
+      , di::bind<int>().to(42)
+      , di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(1 == di::allocations_for<decltype(injector), leaf>(), ""); // copied from the heap, might be elided
+    static_assert(2 == di::allocations_for<decltype(injector), values>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<leaf>>(), "");
+    static_assert(2 == di::allocations_for<decltype(injector), std::shared_ptr<leaf>>(), "");
+    expect_allocations<std::unique_ptr<leaf>>(1, injector);
+    expect_allocations<std::shared_ptr<leaf>>(2, injector);
+};
+
+alignas(std::max_align_t) static char arena_buffer[1024];
+
+class config_arena : public di::config {
+public:
+    auto provider() const noexcept {
+        static di::providers::arena::monotonic_buffer resource{arena_buffer, sizeof(arena_buffer)};
+        return di::providers::arena{resource};
+    }
+};
+
+test arena_provider_allocates_reference_counters = [] {
+    using arena_ptr = std::unique_ptr<i1, di::providers::arena::deleter>;
+    auto injector = di::make_injector<config_arena>(
+        di::bind<i1, impl1>()
+      , di::bind<leaf>().in(di::unique)
+      , di::bind<int>().to(42)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), arena_ptr>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), std::shared_ptr<leaf>>(), "");
+    expect_allocations<arena_ptr>(0, injector);
+    expect_allocations<std::shared_ptr<leaf>>(1, injector);
+};
+
+test child_injector_counts_bindings_of_parent = [] {
+    auto parent = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<leaf>().in(di::shared)
+    );
+
+    auto child = di::make_child_injector(parent
+      , di::bind<int>().to(42)
+      , di::bind<double>().named(name).to(87.0)
+    );
+
+    static_assert(1 == di::allocations_for<decltype(child), std::unique_ptr<i1>>(), "");
+    static_assert(1 == di::allocations_for<decltype(child), pointers>(), "");
+    static_assert(di::allocations_known<decltype(child), pointers>(), "");
+
+    child.create<std::shared_ptr<leaf>>();
+    expect_allocations<std::unique_ptr<i1>>(1, child);
+    expect_allocations<pointers>(1, child);
+};
+
+struct module {
+    auto configure() const noexcept {
+        return di::make_injector(
+            di::bind<i1, impl1>()
+        );
+    }
+};
+
+test exposed_bindings_are_counted_by_module = [] {
+    auto injector = di::make_injector(
+        di::bind<i1>().to(module{})
+    );
+
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<i1>>(), "");
+    static_assert(di::allocations_known<decltype(injector), std::unique_ptr<i1>>(), "");
+    expect_allocations<std::unique_ptr<i1>>(1, injector);
+};
+
+test type_erased_modules_arent_known = [] {
+    di::injector<i1> module = di::make_injector(
+        di::bind<i1, impl1>()
+    );
+
+    auto injector = di::make_injector(
+        di::bind<i1>().to(module)
+    );
+
+    static_assert(0 == di::allocations_for<decltype(injector), std::unique_ptr<i1>>(), "");
+    static_assert(!di::allocations_known<decltype(injector), std::unique_ptr<i1>>(), "");
+    expect_allocations<std::unique_ptr<i1>>(1, injector);
+};
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include "common/allocations.hpp"
+#include "boost/di.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "boost/di/allocations.hpp"
+
+namespace di = boost::di;
+
+auto name = []{};
+
+struct context {
+    int id = 0;
+};
+
+struct i1 { virtual ~i1() noexcept = default; virtual int id() const = 0; };
+
+struct impl1 : i1 {
+    explicit impl1(const context& ctx)
+        : ctx(ctx)
+    { }
+
+    int id() const override { return ctx.id; }
+
+    context ctx;
+};
+
+struct cache {
+    int hits = 0;
+};
+
+struct i2 { virtual ~i2() noexcept = default; virtual void dummy2() = 0; };
+struct impl2 : i2 { void dummy2() override { } };
+
+struct handler {
+    BOOST_DI_INJECT(handler, std::unique_ptr<i1> i, std::shared_ptr<cache> c, (named = name) std::string s)
+        : i(std::move(i)), c(c), s(s)
+    { }
+
+    std::unique_ptr<i1> i;
+    std::shared_ptr<cache> c;
+    std::string s;
+};
+
+struct service {
+    explicit service(const context& ctx)
+        : ctx(ctx)
+    { }
+
+    context ctx;
+};
+
+struct named_int {
+    BOOST_DI_INJECT(named_int, (named = name) int i)
+        : i(i)
+    { }
+
+    int i = 0;
+};
+
+test child_bindings_are_used_by_parent_bindings = [] {
+    auto parent = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<context>().to(context{1})
+      , di::bind<cache>().in(di::singleton)
+      , di::bind<std::string>().named(name).to("parent")
+    );
+
+    auto child = di::make_child_injector(parent, di::bind<context>().to(context{42}));
+
+    expect_eq(1, parent.create<std::unique_ptr<i1>>()->id());
+    expect_eq(42, child.create<std::unique_ptr<i1>>()->id());
+
+    auto object = child.create<handler>();
+    expect_eq(42, object.i->id());
+    expect_eq("parent", object.s);
+
+    static_assert(1 == di::allocations_for<decltype(child), handler>(), "");
+    expect_eq(1u, allocations_of([&] {
+        auto object = child.create<handler>();
+        do_not_optimize(object);
+    }));
+};
+
+test scopes_of_parent_are_shared = [] {
+    auto parent = di::make_injector(
+        di::bind<cache>().in(di::shared)
+      , di::bind<i2, impl2>().in(di::injector_singleton)
+      , di::bind<int>().to(87)
+    );
+
+    {
+    auto child = di::make_child_injector(parent, di::bind<int>().to(42));
+    expect_eq(42, child.create<int>());
+    child.create<std::shared_ptr<cache>>()->hits = 1;
+    expect_eq(parent.create<std::shared_ptr<i2>>(), child.create<std::shared_ptr<i2>>());
+    }
+
+    auto child = di::make_child_injector(parent);
+    expect_eq(1, parent.create<std::shared_ptr<cache>>()->hits);
+    expect_eq(parent.create<std::shared_ptr<cache>>(), child.create<std::shared_ptr<cache>>());
+    expect_eq(&parent.create<cache&>(), &child.create<cache&>());
+    expect_eq(87, child.create<int>());
+};
+
+test parent_instances_are_created_by_parent = [] {
+    auto parent = di::make_injector(
+        di::bind<service>().in(di::shared)
+      , di::bind<context>().to(context{1})
+    );
+
+    {
+    auto child = di::make_child_injector(parent, di::bind<context>().to(context{42}));
+    expect_eq(1, child.create<std::shared_ptr<service>>()->ctx.id);
+    expect_eq(42, child.create<context>().id);
+    }
+
+    expect_eq(1, parent.create<std::shared_ptr<service>>()->ctx.id);
+    expect_eq(1, parent.create<service&>().ctx.id);
+};
+
+test parent_instances_are_created_by_their_owner = [] {
+    auto parent = di::make_injector(
+        di::bind<service>().in(di::shared)
+    );
+
+    auto child = di::make_child_injector(parent, di::bind<context>().to(context{1}));
+    auto grandchild = di::make_child_injector(child, di::bind<context>().to(context{2}));
+
+    expect_eq(0, grandchild.create<std::shared_ptr<service>>()->ctx.id);
+    expect_eq(&parent.create<service&>(), &grandchild.create<service&>());
+    expect_eq(2, grandchild.create<std::unique_ptr<impl1>>()->id());
+};
+
+test child_bindings_take_precedence = [] {
+    auto parent = di::make_injector(
+        di::bind<cache>().in(di::singleton)
+      , di::bind<int>().named(name).to(1)
+    );
+
+    auto child = di::make_child_injector(parent
+      , di::bind<cache>().in(di::unique)
+      , di::bind<int>().named(name).to(42)
+    );
+
+    expect(parent.create<std::shared_ptr<cache>>() != child.create<std::shared_ptr<cache>>());
+    expect(child.create<std::shared_ptr<cache>>() != child.create<std::shared_ptr<cache>>());
+    expect_eq(1, parent.create<named_int>().i);
+    expect_eq(42, child.create<named_int>().i);
+};
+
+test child_of_child = [] {
+    auto parent = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<cache>().in(di::singleton)
+    );
+
+    auto child = di::make_child_injector(parent, di::bind<context>().to(context{1}));
+    auto grandchild = di::make_child_injector(child, di::bind<context>().to(context{2}));
+
+    expect_eq(1, child.create<std::unique_ptr<i1>>()->id());
+    expect_eq(2, grandchild.create<std::unique_ptr<i1>>()->id());
+    expect_eq(parent.create<std::shared_ptr<cache>>(), grandchild.create<std::shared_ptr<cache>>());
+};
+
+test exposed_child = [] {
+    auto parent = di::make_injector(
+        di::bind<i1, impl1>()
+    );
+
+    di::injector<i1> child = di::make_child_injector(parent, di::bind<context>().to(context{42}));
+    expect_eq(42, child.create<std::unique_ptr<i1>>()->id());
+};
+
+test child_doesnt_copy_parent = [] {
+    auto parent = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<cache>().in(di::singleton)
+      , di::bind<std::string>().named(name).to("parent")
+    );
+
+    const context ctx{42};
+    expect_eq(0u, allocations_of([&] {
+        auto child = di::make_child_injector(parent, di::bind<context>().to(ctx));
+        do_not_optimize(child);
+    }));
+};
@@ -4,9 +4,20 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "common/allocations.hpp"
 #include "boost/di.hpp"
+#include "boost/di/allocations.hpp"
 #include "boost/di/providers/heap.hpp"
+#include "boost/di/providers/arena.hpp"
+#include "boost/di/providers/contiguous.hpp"
 #include "boost/di/policies/constructible.hpp"
+#include "boost/di/policies/profiler.hpp"
+#include "boost/di/scopes/pooled.hpp"
 
 namespace di = boost::di;
 
@@ -42,6 +53,13 @@ test call_provider = [] {
     auto injector = di::make_injector<config_provider>();
     injector.create<int>();
     expect_eq(1, called);
+
+    static_assert(1 == di::allocations_for<decltype(injector), int>(), "");
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<int>>(), "");
+    expect_eq(1u, allocations_of([&] {
+        auto object = injector.create<std::unique_ptr<int>>();
+        do_not_optimize(object);
+    }));
 };
 
 struct deleter_provider {
@@ -143,3 +161,402 @@ test call_custom_policies_with_exposed_injector = [] {
     expect_eq(3, policy::called());
 };
 
+struct created_policy {
+    static auto& calls() {
+        static std::vector<std::string> calls;
+        return calls;
+    }
+
+    template<class T>
+    void operator()(const T&) const {
+        calls().push_back(std::string{"call "} + typeid(typename T::type).name());
+    }
+
+    template<class T, class TDependency>
+    void created(const T&, const TDependency&) const {
+        calls().push_back(std::string{"created "} + typeid(typename T::type).name());
+    }
+};
+
+class config_created_policy : public di::config {
+public:
+    auto policies() const noexcept {
+        return di::make_policies(created_policy{});
+    }
+};
+
+struct created_example {
+    created_example(int, double) { }
+};
+
+test call_created_policy_after_creation = [] {
+    created_policy::calls().clear();
+    auto injector = di::make_injector<config_created_policy>();
+    injector.create<created_example>();
+
+    const auto& calls = created_policy::calls();
+    expect_eq(6u, calls.size());
+    expect(std::string{"call "} + typeid(created_example).name() == calls[0]);
+    expect(std::string{"created "} + typeid(created_example).name() == calls[5]);
+    for (auto i = 1; i < 5; i += 2) { // constructor parameters, in unspecified order
+        expect(calls[i].substr(5) == calls[i + 1].substr(8));
+    }
+};
+
+test call_created_policy_when_cached_is_not_defined = [] {
+    created_policy::calls().clear();
+    auto injector = di::make_injector<config_created_policy>(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+    injector.create<std::shared_ptr<i1>>();
+    injector.create<std::shared_ptr<i1>>();
+
+    const auto& calls = created_policy::calls();
+    expect_eq(4u, calls.size());
+    expect(std::string{"created "} + typeid(std::shared_ptr<i1>).name() == calls[3]);
+};
+
+class config_profiler : public di::config {
+public:
+    auto policies() const noexcept {
+        return di::make_policies(profiler.policy());
+    }
+
+    di::policies::profiler profiler;
+};
+
+struct profiled {
+    profiled(std::unique_ptr<i1> i, int) : i(std::move(i)) { }
+    std::unique_ptr<i1> i;
+};
+
+test call_profiler_policy = [] {
+    auto injector = di::make_injector<config_profiler>(
+        di::bind<i1, impl1>()
+      , di::bind<int>().to(42)
+    );
+
+    injector.create<profiled>();
+    injector.create<profiled>();
+
+    auto snapshot = injector.profiler.snapshot();
+    expect_eq(3u, snapshot.size());
+    for (const auto& binding : snapshot) {
+        expect_eq(2u, binding.count);
+        expect(binding.percentile(0.5) <= binding.max);
+        expect(binding.total >= binding.max);
+    }
+
+    auto find = [&](const std::string& type) {
+        for (const auto& binding : snapshot) {
+            if (binding.type == type) {
+                return binding;
+            }
+        }
+        return di::policies::profiler::binding{};
+    };
+    expect_eq(2 * sizeof(impl1), find(di::policies::profiler::type_name<impl1>()).bytes);
+    expect_eq(0u, find(di::policies::profiler::type_name<int>()).bytes);
+    expect_eq(0u, find(di::policies::profiler::type_name<profiled>()).bytes);
+    expect(find(di::policies::profiler::type_name<profiled>()).total >= find(di::policies::profiler::type_name<impl1>()).total); // includes constructor parameters
+
+    std::stringstream json;
+    injector.profiler.dump_json(json);
+    expect(json.str().find("\"type\":\"" + di::policies::profiler::type_name<profiled>()) != std::string::npos);
+
+    injector.profiler.reset();
+    expect(injector.profiler.snapshot().empty());
+};
+
+auto& module_profiler() {
+    static di::policies::profiler profiler;
+    return profiler;
+}
+
+class config_module_profiler : public di::config {
+public:
+    auto policies() const noexcept {
+        return di::make_policies(module_profiler().policy());
+    }
+};
+
+test call_profiler_policy_exposed = [] {
+    module_profiler().reset();
+    di::injector<i1> module = di::make_injector<config_module_profiler>(
+        di::bind<i1, impl1>()
+    );
+    auto injector = di::make_injector<config_module_profiler>(module);
+
+    injector.create<std::unique_ptr<i1>>();
+    injector.create<std::unique_ptr<i1>>();
+
+    auto snapshot = module_profiler().snapshot();
+    expect_eq(2u, snapshot.size()); // `i1` exposed by the module and `impl1` created by it
+    for (const auto& binding : snapshot) {
+        expect_eq(2u, binding.count);
+        expect(binding.total >= binding.max);
+    }
+};
+
+struct throwing {
+    throwing() { throw 0; }
+};
+
+struct throwing_app {
+    explicit throwing_app(std::unique_ptr<throwing>) { }
+};
+
+test call_profiler_policy_exception = [] {
+    auto injector = di::make_injector<config_profiler>();
+
+    auto thrown = 0;
+    for (auto i = 0; i < 2; ++i) {
+        try {
+            injector.create<std::unique_ptr<throwing_app>>();
+        } catch (int) {
+            ++thrown;
+        }
+    }
+    expect_eq(2, thrown);
+    expect(injector.profiler.snapshot().empty());
+
+    injector.create<std::unique_ptr<impl1>>();
+    auto snapshot = injector.profiler.snapshot();
+    expect_eq(1u, snapshot.size());
+    expect_eq(1u, snapshot[0].count);
+};
+
+test call_profiler_policy_shared_hits = [] {
+    auto injector = di::make_injector<config_profiler>(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    injector.create<std::shared_ptr<i1>>();
+    injector.create<std::shared_ptr<i1>>();
+    injector.create<const i1&>();
+
+    auto snapshot = injector.profiler.snapshot();
+    expect_eq(1u, snapshot.size());
+    expect(di::policies::profiler::type_name<impl1>() == snapshot[0].type);
+    expect_eq(1u, snapshot[0].count);
+    expect_eq(2u, snapshot[0].hits);
+};
+
+alignas(std::max_align_t) static char arena_buffer[1024];
+
+auto& arena_resource() {
+    static di::providers::arena::monotonic_buffer resource{arena_buffer, sizeof(arena_buffer)};
+    return resource;
+}
+
+auto in_arena = [](const void* ptr) {
+    auto p = reinterpret_cast<std::uintptr_t>(ptr);
+    auto b = reinterpret_cast<std::uintptr_t>(arena_buffer);
+    return p >= b && p < b + sizeof(arena_buffer);
+};
+
+class config_arena : public di::config {
+public:
+    auto provider() const noexcept {
+        return di::providers::arena{arena_resource()};
+    }
+};
+
+using arena_ptr = std::unique_ptr<i1, di::providers::arena::deleter>;
+
+struct arena_app {
+    BOOST_DI_INJECT(arena_app, arena_ptr u, std::shared_ptr<i1> s, int i)
+        : u(std::move(u)), s(s), i(i)
+    { }
+
+    arena_ptr u;
+    std::shared_ptr<i1> s;
+    int i = 0;
+};
+
+test call_provider_arena = [] {
+    arena_resource().release();
+    auto injector = di::make_injector<config_arena>(
+        di::bind<i1, impl1>().in(di::unique)
+      , di::bind<arena_app>().in(di::unique)
+      , di::bind<int>().to(42)
+    );
+
+    {
+    auto object = injector.create<std::unique_ptr<arena_app, di::providers::arena::deleter>>();
+    expect(in_arena(object.get()));
+    expect(in_arena(object->u.get()));
+    expect(in_arena(object->s.get()));
+    expect(object->u.get() != object->s.get());
+    expect_eq(42, object->i);
+    }
+
+    using arena_app_ptr = std::unique_ptr<arena_app, di::providers::arena::deleter>;
+    static_assert(1 == di::allocations_for<decltype(injector), arena_app_ptr>(), ""); // reference counter of `s`
+    expect_eq(1u, allocations_of([&] {
+        auto object = injector.create<arena_app_ptr>();
+        do_not_optimize(object);
+    }));
+
+    {
+    auto object = injector.create<std::shared_ptr<arena_app>>();
+    expect(in_arena(object.get()));
+    }
+
+    arena_resource().release();
+};
+
+test call_provider_arena_with_parent_keeping_instances = [] {
+    struct c { };
+    arena_resource().release();
+
+    auto parent = di::make_injector(
+        di::bind<c>().in(di::shared)
+    );
+
+    {
+    auto injector = di::make_child_injector<config_arena>(parent
+      , di::bind<i1, impl1>().in(di::unique)
+    );
+
+    auto object = injector.create<arena_ptr>();
+    auto shared = injector.create<std::shared_ptr<c>>();
+    expect(in_arena(object.get()));
+    expect(!in_arena(shared.get())); // created by the parent
+    expect_eq(shared, parent.create<std::shared_ptr<c>>());
+    }
+
+    arena_resource().release();
+};
+
+test call_provider_arena_pooled_scope = [] {
+    static auto dtors = 0;
+    struct c { c() { } ~c() { ++dtors; } };
+
+    dtors = 0;
+    arena_resource().release();
+
+    {
+    auto injector = di::make_injector<config_arena>(
+        di::bind<c>().in(di::pooled)
+    );
+
+    auto object = injector.create<di::pooled_ptr<c>>();
+    auto ptr = object.get();
+    expect(in_arena(ptr));
+    object.reset();
+    expect_eq(ptr, injector.create<di::pooled_ptr<c>>().get());
+    expect_eq(0, dtors);
+    }
+
+    expect_eq(1, dtors); // destroyed by the arena deleter, not deleted
+    arena_resource().release();
+};
+
+struct service_a { service_a() { } int value = 1; };
+struct service_b { service_b() { } int value = 2; };
+
+struct request {
+    BOOST_DI_INJECT(request, std::shared_ptr<i1> i, std::shared_ptr<service_a> a, std::shared_ptr<service_b> b)
+        : i(i), a(a), b(b)
+    { }
+
+    std::shared_ptr<i1> i;
+    std::shared_ptr<service_a> a;
+    std::shared_ptr<service_b> b;
+};
+
+test contiguous_shared_instances = [] {
+    auto injector = di::make_injector<di::contiguous_config<>>(
+        di::bind<i1, impl1>().in(di::shared)
+      , di::bind<service_a>().in(di::shared_mt)
+      , di::bind<service_b>().in(di::shared)
+      , di::bind<request>().in(di::unique)
+    );
+
+    auto storage = injector.storage();
+    expect(storage != nullptr);
+    expect_eq(0u, reinterpret_cast<std::uintptr_t>(storage->data()) % 64);
+
+    auto object = injector.create<std::shared_ptr<request>>();
+    expect(!storage->contains(object.get()));
+    expect(storage->contains(object->i.get()));
+    expect(storage->contains(object->a.get()));
+    expect(storage->contains(object->b.get()));
+    expect_eq(1, object->a->value);
+    expect_eq(2, object->b->value);
+
+    auto copy = injector;
+    expect_eq(object->a, copy.create<std::shared_ptr<service_a>>());
+    expect_eq(storage, copy.storage());
+
+    static_assert(2 == di::allocations_for<decltype(injector), std::shared_ptr<request>>(), "");
+    expect_eq(2u, allocations_of([&] {
+        auto object = injector.create<std::shared_ptr<request>>();
+        do_not_optimize(object);
+    }));
+};
+
+test contiguous_session_instances = [] {
+    auto session = []{};
+    auto injector = di::make_injector<di::contiguous_config<>>(
+        di::bind<service_a>().in(di::session(session))
+    );
+
+    injector.call(di::session_entry(session));
+    auto object = injector.create<std::shared_ptr<service_a>>();
+    auto ptr = object.get();
+    expect(injector.storage()->contains(ptr));
+    object->value = 42;
+    object.reset();
+    injector.call(di::session_exit(session));
+
+    injector.call(di::session_entry(session));
+    object = injector.create<std::shared_ptr<service_a>>();
+    expect_eq(ptr, object.get());
+    expect_eq(1, object->value);
+};
+
+test contiguous_session_instances_outlive_injector = [] {
+    auto session = []{};
+    std::shared_ptr<service_a> object1;
+    std::shared_ptr<service_a> object2;
+    {
+    auto injector = di::make_injector<di::contiguous_config<>>(
+        di::bind<service_a>().in(di::session(session))
+    );
+
+    injector.call(di::session_entry(session));
+    object1 = injector.create<std::shared_ptr<service_a>>();
+    injector.call(di::session_exit(session));
+
+    injector.call(di::session_entry(session));
+    object2 = injector.create<std::shared_ptr<service_a>>(); // slot is taken, allocated on the heap
+    expect(injector.storage()->contains(object1.get()));
+    expect(!injector.storage()->contains(object2.get()));
+    }
+
+    object1.reset();
+    expect_eq(1, object2->value);
+    object2.reset();
+};
+
+test contiguous_instances_outlive_injector = [] {
+    std::shared_ptr<service_a> object;
+    {
+    auto injector = di::make_injector<di::contiguous_config<>>(
+        di::bind<service_a>().in(di::shared)
+    );
+    object = injector.create<std::shared_ptr<service_a>>();
+    }
+    expect_eq(1, object->value);
+};
+
+test contiguous_without_shared_bindings = [] {
+    auto injector = di::make_injector<di::contiguous_config<>>(
+        di::bind<i1, impl1>().in(di::unique)
+    );
+
+    expect(nullptr == injector.storage());
+    expect(nullptr != injector.create<std::shared_ptr<i1>>());
+};
@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#define BOOST_DI_CFG_LOCAL_SHARED_PTR
+#include <memory>
+#include <boost/di.hpp>
+#include "common/allocations.hpp"
+
+namespace di = boost::di;
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+
+auto name = []{};
+
+struct fan_out {
+    BOOST_DI_INJECT(fan_out, di::local_shared_ptr<i1> l1, di::local_shared_ptr<i1> l2, std::shared_ptr<i1> s, const i1& r)
+        : l1(l1), l2(l2), s(s), r(r)
+    { }
+
+    di::local_shared_ptr<i1> l1;
+    di::local_shared_ptr<i1> l2;
+    std::shared_ptr<i1> s;
+    const i1& r;
+};
+
+test shared_scope_hands_out_local_shared_ptr = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    auto object = injector.create<fan_out>();
+    expect_eq(object.l1.get(), object.l2.get());
+    expect_eq(object.l1.get(), object.s.get());
+    expect_eq(object.l1.get(), &object.r);
+    expect_eq(3u, object.l1.use_count()); // scope and two parameters
+};
+
+test shared_scope_keeps_instance_and_counters_in_one_allocation = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    expect_eq(1u, allocations_of([&] {
+        auto object = injector.create<di::local_shared_ptr<i1>>();
+        do_not_optimize(object);
+    }));
+
+    expect_eq(0u, allocations_of([&] {
+        auto object = injector.create<fan_out>();
+        do_not_optimize(object);
+    }));
+};
+
+test shared_scope_hands_out_std_and_weak_ptr = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    auto object = injector.create<di::local_shared_ptr<i1>>();
+    auto sp = injector.create<std::shared_ptr<i1>>();
+    expect_eq(object.get(), sp.get());
+    expect_eq(object.get(), injector.create<std::weak_ptr<i1>>().lock().get());
+    expect_eq(static_cast<const i1*>(object.get()), &injector.create<const i1&>());
+};
+
+test shared_scope_passes_const_std_shared_ptr_ref = [] {
+    auto injector = di::make_injector(
+        di::bind<impl1>().in(di::shared)
+    );
+
+    expect_eq(&injector.create<const std::shared_ptr<impl1>&>(), &injector.create<const std::shared_ptr<impl1>&>());
+};
+
+test singleton_scope_keeps_std_shared_ptr = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::singleton)
+    );
+
+    auto object1 = injector.create<di::local_shared_ptr<i1>>();
+    auto object2 = injector.create<di::local_shared_ptr<i1>>();
+    expect_eq(object1.get(), object2.get());
+    expect_eq(1u, object1.use_count()); // each allocates its counter
+    expect_eq(object1.get(), injector.create<std::shared_ptr<i1>>().get());
+};
+
+test session_scope_releases_local_shared_ptr = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::session(name))
+    );
+
+    injector.call(di::session_entry(name));
+    auto object = injector.create<di::local_shared_ptr<i1>>();
+    expect(object);
+    expect_eq(2u, object.use_count());
+
+    injector.call(di::session_exit(name));
+    expect_eq(1u, object.use_count());
+    expect(!injector.create<di::local_shared_ptr<i1>>());
+};
+
+test unique_scope_local_shared_ptr = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::unique)
+    );
+
+    auto object1 = injector.create<di::local_shared_ptr<i1>>();
+    auto object2 = injector.create<di::local_shared_ptr<i1>>();
+    expect(object1.get() != object2.get());
+    expect_eq(1u, object1.use_count());
+};
+
+test deduce_scope_local_shared_ptr_is_singleton = [] {
+    auto injector = di::make_injector();
+    auto object1 = injector.create<di::local_shared_ptr<impl1>>();
+    auto object2 = injector.create<di::local_shared_ptr<impl1>>();
+    expect_eq(object1.get(), object2.get());
+};
+
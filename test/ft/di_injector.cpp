@@ -4,7 +4,16 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <typeindex>
+#include <vector>
 #include "boost/di.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "boost/di/async.hpp"
+#include "boost/di/warm_up.hpp"
 
 namespace di = boost::di;
 
@@ -87,3 +96,375 @@ test injectors_mix = [] {
     expect(object->i1_.get());
 };
 
+test make_factory_creates_like_create = [] {
+    struct c {
+        c(std::unique_ptr<i1> p1, std::shared_ptr<complex1> c1, int i)
+            : p1(std::move(p1)), c1(c1), i(i)
+        { }
+
+        std::unique_ptr<i1> p1;
+        std::shared_ptr<complex1> c1;
+        int i = 0;
+    };
+
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<complex1>().in(di::shared)
+      , di::bind<int>().to(42)
+    );
+
+    auto factory = injector.make_factory<c>();
+    auto object1 = factory();
+    auto object2 = factory();
+    auto object3 = injector.create<c>();
+
+    expect(dynamic_cast<impl1*>(object1.p1.get()));
+    expect(object1.p1 != object2.p1);
+    expect_eq(object1.c1, object2.c1);
+    expect_eq(object1.c1, object3.c1);
+    expect_eq(42, object1.i);
+};
+
+test make_factory_doesnt_call_policies = [] {
+    static auto calls = 0;
+
+    class config : public di::config {
+    public:
+        auto policies() const noexcept {
+            return di::make_policies([](auto) { ++calls; });
+        }
+    };
+
+    auto injector = di::make_injector<config>(
+        di::bind<i1, impl1>()
+    );
+
+    calls = 0;
+    injector.create<std::shared_ptr<complex1>>();
+    expect(calls > 0);
+
+    calls = 0;
+    auto factory = injector.make_factory<std::shared_ptr<complex1>>();
+    auto object = factory();
+    expect(object->i1_.get());
+    expect_eq(0, calls);
+};
+
+template<int N>
+struct warm {
+    warm() {
+        ++ctor_calls();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+};
+
+struct warm_graph {
+    warm_graph(std::shared_ptr<warm<0>> w0, std::shared_ptr<warm<1>> w1)
+        : w0(w0), w1(w1)
+    { }
+
+    std::shared_ptr<warm<0>> w0;
+    std::shared_ptr<warm<1>> w1;
+};
+
+test warm_up_creates_instances_up_front = [] {
+    warm<0>::ctor_calls() = 0;
+    warm<1>::ctor_calls() = 0;
+    warm<2>::ctor_calls() = 0;
+    warm<3>::ctor_calls() = 0;
+
+    auto injector = di::make_injector(
+        di::bind<warm<0>>().in(di::injector_singleton)
+      , di::bind<warm<1>>().in(di::shared)
+      , di::bind<warm<2>>().in(di::unique)
+      , di::bind<warm<3>>().in(di::shared_mt)
+      , di::bind<warm_graph>().in(di::injector_singleton)
+    );
+
+    injector.warm_up();
+
+    expect_eq(1, warm<0>::ctor_calls().load());
+    expect_eq(1, warm<1>::ctor_calls().load());
+    expect_eq(0, warm<2>::ctor_calls().load());
+    expect_eq(1, warm<3>::ctor_calls().load());
+
+    auto graph = injector.create<std::shared_ptr<warm_graph>>();
+    injector.create<std::shared_ptr<warm<3>>>();
+    expect_eq(graph->w0, injector.create<std::shared_ptr<warm<0>>>());
+    expect_eq(1, warm<0>::ctor_calls().load());
+    expect_eq(1, warm<1>::ctor_calls().load());
+    expect_eq(1, warm<3>::ctor_calls().load());
+};
+
+test warm_up_reports_bindings = [] {
+    auto injector = di::make_injector(
+        di::bind<warm<0>>().in(di::injector_singleton)
+      , di::bind<warm<1>>().in(di::shared)
+      , di::bind<warm<2>>().in(di::unique)
+      , di::bind<warm_graph>().in(di::injector_singleton)
+    );
+
+    std::vector<std::type_index> reported;
+    std::chrono::nanoseconds total{};
+    injector.warm_up([&](auto binding, std::chrono::nanoseconds duration) {
+        reported.push_back(typeid(typename decltype(binding)::given));
+        total += duration;
+    }, 4);
+
+    expect_eq(3u, reported.size());
+    expect(reported[0] == typeid(warm<0>)); // thread-safe graph, created in parallel before the others
+    expect(reported[2] == typeid(warm_graph)); // unknown constructor, created on the calling thread
+    expect(total >= std::chrono::milliseconds(2));
+};
+
+struct warm_thread_unsafe {
+    BOOST_DI_INJECT(explicit warm_thread_unsafe, std::shared_ptr<warm<1>> w1)
+        : w1(w1), id(std::this_thread::get_id())
+    { }
+
+    std::shared_ptr<warm<1>> w1;
+    std::thread::id id;
+};
+
+test warm_up_creates_graphs_with_thread_unsafe_scopes_on_calling_thread = [] {
+    auto injector = di::make_injector(
+        di::bind<warm<1>>().in(di::shared)
+      , di::bind<warm_thread_unsafe>().in(di::singleton)
+    );
+
+    injector.warm_up([](const auto&, const auto&) { }, 4);
+
+    expect(std::this_thread::get_id() == injector.create<std::shared_ptr<warm_thread_unsafe>>()->id);
+};
+
+struct warm_dependent {
+    BOOST_DI_INJECT(explicit warm_dependent, std::shared_ptr<warm<4>> w4)
+        : w4(w4)
+    { }
+
+    std::shared_ptr<warm<4>> w4;
+};
+
+test warm_up_creates_dependencies_first = [] {
+    warm<4>::ctor_calls() = 0;
+
+    auto injector = di::make_injector(
+        di::bind<warm_dependent>().in(di::injector_singleton)
+      , di::bind<warm<4>>().in(di::injector_singleton)
+    );
+
+    std::chrono::nanoseconds durations[2]{};
+    auto i = 0;
+    injector.warm_up([&](const auto&, std::chrono::nanoseconds duration) { durations[i++] = duration; }, 4);
+
+    expect_eq(1, warm<4>::ctor_calls().load());
+    expect(durations[0] < durations[1]); // `warm<4>` was created already when `warm_dependent` was
+};
+
+test warm_up_single_thread = [] {
+    warm<0>::ctor_calls() = 0;
+
+    auto injector = di::make_injector(
+        di::bind<warm<0>>().in(di::injector_singleton)
+      , di::bind<warm_graph>().in(di::injector_singleton)
+    );
+
+    auto bindings = 0;
+    injector.warm_up([&](const auto&, const auto&) { ++bindings; }, 1);
+
+    expect_eq(2, bindings);
+    expect_eq(1, warm<0>::ctor_calls().load());
+};
+
+struct warm_throws {
+    warm_throws() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        throw 42;
+    }
+};
+
+test warm_up_rethrows_exceptions_of_parallel_bindings = [] {
+    auto injector = di::make_injector(
+        di::bind<warm<5>>().in(di::injector_singleton)
+      , di::bind<warm<6>>().in(di::injector_singleton)
+      , di::bind<warm_throws>().in(di::injector_singleton)
+      , di::bind<warm_dependent>().in(di::injector_singleton)
+      , di::bind<warm<4>>().in(di::injector_singleton)
+    );
+
+    auto thrown = 0;
+    try {
+        injector.warm_up([](const auto&, const auto&) { }, 4);
+    } catch (int value) {
+        thrown = value;
+    }
+
+    expect_eq(42, thrown);
+};
+
+template<int N>
+struct slow {
+    slow() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    int value = N;
+};
+
+struct slow_graph {
+    BOOST_DI_INJECT(slow_graph, slow<1> s1, std::unique_ptr<slow<2>> s2, slow<3> s3, int i)
+        : value(s1.value + s2->value + s3.value + i)
+    { }
+
+    int value = 0;
+};
+
+struct async_executor {
+    void operator()(const std::function<void()>& task) const {
+        threads.emplace_back(task);
+    }
+
+    ~async_executor() {
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    mutable std::vector<std::thread> threads;
+};
+
+test create_async_creates_arguments_concurrently = [] {
+    using clock = std::chrono::steady_clock;
+    auto injector = di::make_injector(
+        di::bind<int>().to(4)
+    );
+
+    const auto start = clock::now();
+    int value = 0;
+    {
+        async_executor executor;
+        auto future = di::create_async<slow_graph>(injector, executor);
+        value = future.get().value;
+        expect_eq(4u, executor.threads.size()); // one task per argument
+    }
+    const auto async = clock::now() - start;
+    expect_eq(10, value);
+
+    const auto sequential_start = clock::now();
+    expect_eq(10, injector.create<slow_graph>().value);
+    const auto sequential = clock::now() - sequential_start;
+
+    expect(sequential >= std::chrono::milliseconds(150)); // 3 slow leaves, 50ms each
+    expect(async < std::chrono::milliseconds(140));
+};
+
+test create_async_deduced_ctor = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+    );
+
+    auto tasks = 0;
+    auto future = injector.create_async<std::unique_ptr<complex1>>([&](const auto& task) { ++tasks; task(); });
+
+    expect_eq(1, tasks);
+    expect(dynamic_cast<impl1*>(future.get()->i1_.get()));
+};
+
+struct async_c {
+    async_c() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ++ctor_calls();
+    }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+};
+
+struct async_a {
+    BOOST_DI_INJECT(explicit async_a, std::shared_ptr<async_c> c)
+        : c(c)
+    { }
+
+    std::shared_ptr<async_c> c;
+};
+
+struct async_b {
+    BOOST_DI_INJECT(explicit async_b, std::shared_ptr<async_c> c)
+        : c(c)
+    { }
+
+    std::shared_ptr<async_c> c;
+};
+
+struct async_graph {
+    BOOST_DI_INJECT(async_graph, std::shared_ptr<async_a> a, std::shared_ptr<async_b> b)
+        : a(a), b(b)
+    { }
+
+    std::shared_ptr<async_a> a;
+    std::shared_ptr<async_b> b;
+};
+
+test create_async_shared_dependency_sequentially = [] {
+    async_c::ctor_calls() = 0;
+    auto injector = di::make_injector(
+        di::bind<async_a>().in(di::unique)
+      , di::bind<async_b>().in(di::unique)
+      , di::bind<async_c>().in(di::shared) // not thread-safe, arguments are created by a single task
+    );
+
+    async_graph* object = nullptr;
+    async_executor executor;
+    auto future = di::create_async<std::unique_ptr<async_graph>>(injector, executor);
+    auto result = future.get();
+    object = result.get();
+
+    expect_eq(1u, executor.threads.size());
+    expect_eq(1, async_c::ctor_calls().load());
+    expect_eq(object->a->c, object->b->c);
+};
+
+test create_async_shared_mt_dependency_concurrently = [] {
+    async_c::ctor_calls() = 0;
+    auto injector = di::make_injector(
+        di::bind<async_a>().in(di::unique)
+      , di::bind<async_b>().in(di::unique)
+      , di::bind<async_c>().in(di::shared_mt)
+    );
+
+    async_executor executor;
+    auto future = di::create_async<std::unique_ptr<async_graph>>(injector, executor);
+    auto object = future.get();
+
+    expect_eq(2u, executor.threads.size());
+    expect_eq(1, async_c::ctor_calls().load());
+    expect_eq(object->a->c, object->b->c);
+};
+
+struct throws {
+    throws() { throw 42; }
+};
+
+struct throws_graph {
+    BOOST_DI_INJECT(throws_graph, std::unique_ptr<throws>, slow<1>) { }
+};
+
+test create_async_exception = [] {
+    auto injector = di::make_injector();
+    auto future = di::create_async<throws_graph>(injector, [](const auto& task) { task(); });
+
+    auto caught = false;
+    try {
+        future.get();
+    } catch (int i) {
+        caught = i == 42;
+    }
+    expect(caught);
+};
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+
+namespace di = boost::di;
+
+auto name = []{};
+
+struct i1 { virtual ~i1() noexcept = default; virtual int get() const = 0; };
+
+struct impl1 : i1 {
+    impl1() { ++ctor_calls(); }
+    int get() const override { return 42; }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+};
+
+struct report {
+    explicit report(int value)
+        : value(value)
+    { ++ctor_calls(); }
+
+    static int& ctor_calls() {
+        static int calls = 0;
+        return calls;
+    }
+
+    int value = 0;
+};
+
+struct service {
+    BOOST_DI_INJECT(service, di::lazy<std::unique_ptr<i1>> i, (named = name) di::lazy<report> r)
+        : i(std::move(i)), r(std::move(r))
+    { }
+
+    di::lazy<std::unique_ptr<i1>> i;
+    di::lazy<report> r;
+};
+
+struct deduced_service {
+    deduced_service(di::lazy<std::shared_ptr<i1>> i, di::lazy<const report&> r)
+        : i(std::move(i)), r(std::move(r))
+    { }
+
+    di::lazy<std::shared_ptr<i1>> i;
+    di::lazy<const report&> r;
+};
+
+test dependencies_are_created_on_first_use = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+      , di::bind<int>().to(87)
+      , di::bind<report>().named(name).in(di::unique)
+    );
+
+    impl1::ctor_calls() = 0;
+    report::ctor_calls() = 0;
+    auto object = injector.create<service>();
+    expect(!object.i.is_created());
+    expect(!object.r.is_created());
+    expect_eq(0, impl1::ctor_calls());
+    expect_eq(0, report::ctor_calls());
+
+    expect_eq(42, object.i->get());
+    expect_eq(42, (*object.i)->get());
+    expect(object.i.is_created());
+    expect(!object.r.is_created());
+    expect_eq(1, impl1::ctor_calls());
+
+    expect_eq(87, object.r->value);
+    expect_eq(87, object.r.get().value);
+    expect_eq(1, impl1::ctor_calls());
+    expect_eq(1, report::ctor_calls());
+};
+
+test lazy_dependencies_use_scopes_of_bindings = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::singleton)
+      , di::bind<int>().to(87)
+      , di::bind<report>().in(di::singleton)
+    );
+
+    auto object = injector.create<deduced_service>();
+    expect(!object.i.is_created());
+    expect_eq(injector.create<std::shared_ptr<i1>>(), object.i.get());
+    expect_eq(&injector.create<const report&>(), &object.r.get());
+    expect_eq(87, object.r->value);
+};
+
+test create_lazy = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>()
+    );
+
+    impl1::ctor_calls() = 0;
+    auto object = injector.create<di::lazy<std::unique_ptr<i1>>>();
+    expect_eq(0, impl1::ctor_calls());
+    expect_eq(42, object->get());
+
+    auto moved = std::move(object);
+    expect(moved.is_created());
+    expect_eq(42, moved->get());
+    expect_eq(1, impl1::ctor_calls());
+};
+
+struct throwing {
+    throwing() {
+        if (!calls()++) {
+            throw std::runtime_error{"first"};
+        }
+    }
+
+    static int& calls() {
+        static int calls = 0;
+        return calls;
+    }
+};
+
+test creation_which_threw_is_repeated = [] {
+    auto injector = di::make_injector();
+    auto object = injector.create<di::lazy<std::unique_ptr<throwing>>>();
+
+    auto thrown = false;
+    try {
+        object.get();
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+
+    expect(thrown);
+    expect(!object.is_created());
+    expect(object.get() != nullptr);
+    expect_eq(2, throwing::calls());
+};
+
+struct shared_service {
+    BOOST_DI_INJECT(shared_service, di::lazy_mt<std::shared_ptr<i1>> i)
+        : i(std::move(i))
+    { }
+
+    di::lazy_mt<std::shared_ptr<i1>> i;
+};
+
+test lazy_mt_creates_once = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::unique)
+    );
+
+    for (auto iteration = 0; iteration < 10; ++iteration) {
+        impl1::ctor_calls() = 0;
+        auto object = injector.create<shared_service>();
+        std::atomic<int> sum{0};
+        std::vector<std::thread> threads;
+        for (auto i = 0; i < 4; ++i) {
+            threads.emplace_back([&] { sum += object.i->get(); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        expect_eq(4 * 42, sum.load());
+        expect_eq(1, impl1::ctor_calls());
+    }
+};
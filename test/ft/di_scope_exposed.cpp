@@ -6,6 +6,7 @@
 //
 #include <memory>
 #include "boost/di.hpp"
+#include "boost/di/allocations.hpp"
 
 namespace di = boost::di;
 
@@ -264,6 +265,8 @@ test exposed_bind_interface_module = [] {
     auto object = injector.create<std::unique_ptr<c>>();
 
     expect(dynamic_cast<impl1*>(object->i.get()));
+    static_assert(1 == di::allocations_for<decltype(injector), std::unique_ptr<c>>(), "");
+    static_assert(!di::allocations_known<decltype(injector), std::unique_ptr<c>>(), ""); // `i` is created by a type erased injector
 };
 
 test exposed_module_with_unique_ptr = [] {
@@ -304,3 +307,66 @@ test exposed_module_with_unique_ptr = [] {
     expect(42 == object->i);
 };
 
+struct complex4 {
+    explicit complex4(const std::shared_ptr<i1>& i1)
+        : i1_(i1)
+    { }
+
+    std::shared_ptr<i1> i1_;
+};
+
+test exposed_types_share_module_state = [] {
+    di::injector<complex1, complex4> injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    auto object1 = injector.create<std::unique_ptr<complex1>>();
+    auto object4 = injector.create<std::unique_ptr<complex4>>();
+    expect(object1->i1_.get() == object4->i1_.get());
+};
+
+struct copy_counter {
+    copy_counter() noexcept { }
+    copy_counter(const copy_counter&) noexcept { ++copies; }
+    static int copies;
+};
+
+int copy_counter::copies = 0;
+
+test exposed_types_copy_module_once = [] {
+    auto module = [] {
+        return di::make_injector(
+            di::bind<i1, impl1>()
+          , di::bind<copy_counter>().to(copy_counter{})
+        );
+    };
+
+    auto exposed = [](const auto& injector) {
+        copy_counter::copies = 0;
+        di::injector<complex1> one = injector;
+        const auto copies_one = copy_counter::copies;
+
+        copy_counter::copies = 0;
+        di::injector<complex1, complex4, i1> three = injector;
+        const auto copies_three = copy_counter::copies;
+
+        (void)one; (void)three;
+        return copies_one == copies_three;
+    };
+
+    expect(exposed(module()));
+};
+
+test exposed_injector_copies_share_module_state = [] {
+    auto module = di::make_injector(
+        di::bind<i1, impl1>().in(di::shared)
+    );
+
+    di::injector<complex1> injector = module;
+    auto copy = injector;
+    di::injector<complex1> other = module;
+
+    auto object = injector.create<std::unique_ptr<complex1>>();
+    expect(object->i1_.get() == copy.create<std::unique_ptr<complex1>>()->i1_.get());
+    expect(object->i1_.get() != other.create<std::unique_ptr<complex1>>()->i1_.get());
+};
@@ -259,3 +259,61 @@ test scopes_injector_lambda_injector = [] {
     expect_eq(s, injector.create<int>());
 };
 
+struct copies_moves {
+    copies_moves() = default;
+    copies_moves(const copies_moves&) { ++copies(); }
+    copies_moves(copies_moves&&) { ++moves(); }
+
+    static int& copies() { static auto i = 0; return i; }
+    static int& moves() { static auto i = 0; return i; }
+};
+
+test scopes_external_rvalue_no_copies = [] {
+    copies_moves::copies() = 0;
+    copies_moves::moves() = 0;
+
+    auto injector = di::make_injector(
+        di::bind<copies_moves>().to(copies_moves{})
+    );
+
+    expect_eq(0, copies_moves::copies());
+    expect(copies_moves::moves() > 0);
+
+    injector.create<copies_moves>();
+    expect_eq(1, copies_moves::copies());
+};
+
+test scopes_external_lvalue_dependency = [] {
+    constexpr auto i = 42;
+    auto dependency = di::bind<int>().to(i);
+    auto injector = di::make_injector(dependency);
+
+    expect_eq(i, injector.create<int>());
+};
+
+struct move_only {
+    std::unique_ptr<int> ptr;
+};
+
+struct move_only_ref {
+    move_only_ref(const move_only& object, move_only& ref)
+        : object(object), ref(ref)
+    { }
+
+    const move_only& object;
+    move_only& ref;
+};
+
+test scopes_external_move_only = [] {
+    constexpr auto i = 42;
+    auto injector = di::make_injector(
+        di::bind<move_only>().to(move_only{std::make_unique<int>(i)})
+    );
+
+    auto&& object = injector.create<const move_only&>();
+    expect_eq(i, *object.ptr);
+
+    auto refs = injector.create<move_only_ref>();
+    expect_eq(&object, &refs.object);
+    expect_eq(&object, &refs.ref);
+};
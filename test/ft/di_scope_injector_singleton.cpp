@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+
+namespace di = boost::di;
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+struct i2 { virtual ~i2() noexcept = default; virtual void dummy2() = 0; };
+struct impl2 : i2 { void dummy2() override { } };
+
+struct counted {
+    counted() { ++ctor_calls(); }
+    ~counted() noexcept { ++dtor_calls(); }
+
+    static std::atomic<int>& ctor_calls() { static std::atomic<int> calls{0}; return calls; }
+    static std::atomic<int>& dtor_calls() { static std::atomic<int> calls{0}; return calls; }
+};
+
+auto name1 = []{};
+auto name2 = []{};
+
+test create_injector_singleton = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::injector_singleton)
+      , di::bind<i2, impl2>().in(di::injector_singleton)
+    );
+
+    auto object = injector.create<std::shared_ptr<i1>>();
+    expect(object.get());
+    expect_eq(object, injector.create<std::shared_ptr<i1>>());
+    expect_eq(object.get(), &injector.create<i1&>());
+    expect(static_cast<void*>(object.get()) != static_cast<void*>(injector.create<std::shared_ptr<i2>>().get()));
+};
+
+test injector_singleton_per_injector = [] {
+    auto make = [] {
+        return di::make_injector(di::bind<i1, impl1>().in(di::injector_singleton));
+    };
+
+    auto injector1 = make();
+    auto injector2 = make();
+
+    expect(injector1.create<std::shared_ptr<i1>>() != injector2.create<std::shared_ptr<i1>>());
+    expect_eq(injector1.create<std::shared_ptr<i1>>(), injector1.create<std::shared_ptr<i1>>());
+};
+
+struct named_singletons {
+    BOOST_DI_INJECT(named_singletons, (named = name1) std::shared_ptr<i1> object1, (named = name2) std::shared_ptr<i1> object2)
+        : object1(object1), object2(object2)
+    { }
+
+    std::shared_ptr<i1> object1;
+    std::shared_ptr<i1> object2;
+};
+
+test injector_singleton_named = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().named(name1).in(di::injector_singleton)
+      , di::bind<i1, impl1>().named(name2).in(di::injector_singleton)
+    );
+
+    auto objects1 = injector.create<named_singletons>();
+    auto objects2 = injector.create<named_singletons>();
+    expect(objects1.object1 != objects1.object2);
+    expect_eq(objects1.object1, objects2.object1);
+    expect_eq(objects1.object2, objects2.object2);
+};
+
+test injector_singleton_released_with_injector = [] {
+    counted::ctor_calls() = 0;
+    counted::dtor_calls() = 0;
+
+    {
+    auto injector = di::make_injector(
+        di::bind<counted>().in(di::injector_singleton)
+    );
+    injector.create<counted&>();
+    injector.create<const counted&>();
+    expect_eq(1, counted::ctor_calls().load());
+    expect_eq(0, counted::dtor_calls().load());
+    }
+
+    expect_eq(1, counted::dtor_calls().load());
+};
+
+test injector_singleton_module = [] {
+    auto module = [] {
+        return di::make_injector(di::bind<i1, impl1>().in(di::injector_singleton));
+    };
+
+    auto injector = di::make_injector(module());
+    expect_eq(injector.create<std::shared_ptr<i1>>(), injector.create<std::shared_ptr<i1>>());
+};
+
+struct service {
+    explicit service(std::shared_ptr<i1> object)
+        : object(object)
+    { }
+
+    std::shared_ptr<i1> object;
+};
+
+test injector_singleton_exposed_module = [] {
+    auto module = []() -> di::injector<service> {
+        return di::make_injector(di::bind<i1, impl1>().in(di::injector_singleton));
+    };
+
+    auto injector = di::make_injector(module());
+    expect_eq(injector.create<service>().object, injector.create<service>().object);
+};
+
+test create_injector_singleton_concurrently = [] {
+    constexpr auto threads = 8;
+    counted::ctor_calls() = 0;
+
+    auto injector = di::make_injector(
+        di::bind<counted>().in(di::injector_singleton)
+    );
+
+    std::atomic<bool> ready{false};
+    std::vector<const counted*> objects(threads);
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i] {
+            while (!ready.load(std::memory_order_acquire)) { }
+            objects[i] = &injector.create<const counted&>();
+        });
+    }
+    ready.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    expect_eq(1, counted::ctor_calls().load());
+    for (const auto& object : objects) {
+        expect_eq(objects[0], object);
+    }
+};
@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/scopes/pooled.hpp"
+
+namespace di = boost::di;
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+
+struct codec {
+    virtual ~codec() noexcept = default;
+    virtual int encode(int) = 0;
+};
+
+struct counting_codec : codec {
+    counting_codec() { ++ctor_calls(); }
+    int encode(int value) override { return value + calls++; }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+
+    int calls = 0;
+};
+
+struct codec_reset {
+    void operator()(counting_codec& object) const noexcept {
+        object.calls = 0;
+    }
+};
+
+struct handler {
+    BOOST_DI_INJECT(handler, di::pooled_ptr<codec> c, std::shared_ptr<i1> i)
+        : c(std::move(c)), i(i)
+    { }
+
+    di::pooled_ptr<codec> c;
+    std::shared_ptr<i1> i;
+};
+
+test pooled_objects_are_reused = [] {
+    auto injector = di::make_injector(
+        di::bind<codec, counting_codec>().in(di::scopes::pooled<codec_reset>{})
+      , di::bind<i1, impl1>().in(di::pooled)
+    );
+
+    counting_codec::ctor_calls() = 0;
+    codec* first = nullptr;
+    i1* first_i = nullptr;
+
+    {
+    auto object = injector.create<handler>();
+    expect_eq(42, object.c->encode(42));
+    expect_eq(43, object.c->encode(42));
+    first = object.c.get();
+    first_i = object.i.get();
+    }
+
+    for (auto i = 0; i < 10; ++i) {
+        auto object = injector.create<handler>();
+        expect_eq(first, object.c.get());
+        expect_eq(first_i, object.i.get());
+        expect_eq(42, object.c->encode(42)); // reset when returned
+    }
+
+    expect_eq(1, counting_codec::ctor_calls());
+    const auto stats = di::scopes::pooled<codec_reset>::stats<counting_codec>();
+    expect_eq(10u, stats.hits);
+    expect_eq(1u, stats.misses);
+};
+
+struct name {
+    name() noexcept { }
+    int value = 0;
+};
+
+struct named {
+    BOOST_DI_INJECT(explicit named, const name& n) noexcept
+        : n(n)
+    { }
+
+    const name& n;
+};
+
+test pooled_objects_per_injector = [] {
+    name n1;
+    n1.value = 1;
+    auto injector1 = di::make_injector(
+        di::bind<named>().in(di::pooled)
+      , di::bind<name>().to(n1)
+    );
+
+    named* first = nullptr;
+    {
+    name n2;
+    n2.value = 2;
+    auto injector2 = di::make_injector(
+        di::bind<named>().in(di::pooled)
+      , di::bind<name>().to(n2)
+    );
+    first = injector2.create<di::pooled_ptr<named>>().get();
+    auto object = injector2.create<di::pooled_ptr<named>>();
+    expect_eq(first, object.get());
+    expect_eq(2, object->n.value);
+    }
+
+    for (auto i = 0; i < 2; ++i) {
+        auto object = injector1.create<di::pooled_ptr<named>>();
+        expect_eq(1, object->n.value); // never recycled from the other injector
+    }
+
+    auto copy = injector1;
+    named* object = injector1.create<di::pooled_ptr<named>>().get();
+    expect_eq(object, copy.create<di::pooled_ptr<named>>().get());
+};
+
+test pooled_objects_outlive_injector = [] {
+    counting_codec::ctor_calls() = 0;
+    di::pooled_ptr<codec> object1;
+    std::shared_ptr<codec> object2;
+    {
+    auto injector = di::make_injector(
+        di::bind<codec, counting_codec>().in(di::pooled)
+    );
+    object1 = injector.create<di::pooled_ptr<codec>>();
+    object2 = injector.create<std::shared_ptr<codec>>();
+    injector.create<di::pooled_ptr<codec>>();
+    }
+    expect_eq(2, object1->encode(2));
+    object1.reset();
+    object2.reset();
+    expect_eq(3, counting_codec::ctor_calls());
+};
+
+test pooled_objects_released_by_another_thread = [] {
+    auto injector = di::make_injector(
+        di::bind<codec, counting_codec>().in(di::pooled)
+    );
+
+    auto object = injector.create<di::pooled_ptr<codec>>();
+    auto ptr = object.get();
+    std::thread{[&] { object.reset(); }}.join();
+    expect_eq(ptr, injector.create<di::pooled_ptr<codec>>().get());
+};
+
+test pooled_create_concurrently = [] {
+    constexpr auto threads = 8;
+    constexpr auto iterations = 1000;
+    using pooled_t = di::scopes::pooled<di::scopes::no_reset, 16, 4>;
+
+    auto injector = di::make_injector(
+        di::bind<codec, counting_codec>().in(pooled_t{})
+    );
+
+    const auto before = pooled_t::stats<counting_codec>();
+    std::atomic<bool> ready{false};
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&] {
+            while (!ready.load()) { }
+            std::vector<di::pooled_ptr<codec>> objects;
+            for (auto n = 0; n < iterations; ++n) {
+                objects.push_back(injector.create<di::pooled_ptr<codec>>());
+                if (objects.size() == 8) {
+                    objects.clear();
+                }
+            }
+        });
+    }
+
+    ready = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    const auto stats = pooled_t::stats<counting_codec>();
+    expect_eq(std::size_t(threads * iterations), stats.hits + stats.misses - before.hits - before.misses);
+    expect(stats.hits > stats.misses);
+};
+
+
+struct virtual_codec : virtual codec {
+    int encode(int value) override { return value; }
+};
+
+test pooled_objects_of_virtual_bases = [] {
+    auto injector = di::make_injector(
+        di::bind<codec, virtual_codec>().in(di::pooled)
+    );
+
+    codec* first = nullptr;
+    {
+    auto object = injector.create<di::pooled_ptr<codec>>();
+    expect_eq(42, object->encode(42));
+    first = object.get();
+    }
+
+    auto object = injector.create<std::shared_ptr<codec>>();
+    expect_eq(first, object.get());
+    expect_eq(1u, di::scopes::pooled<>::stats<virtual_codec>().hits);
+};
@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/scopes/reloadable.hpp"
+#include "boost/di/warm_up.hpp"
+
+namespace di = boost::di;
+
+struct config {
+    config() noexcept { }
+
+    int version = 1;
+};
+
+struct i_router {
+    virtual ~i_router() noexcept = default;
+    virtual int route() const = 0;
+};
+
+struct router : i_router {
+    explicit router(const config& c)
+        : version(c.version) {
+        ++instances();
+    }
+
+    ~router() noexcept override {
+        version = 0;
+        --instances();
+    }
+
+    int route() const override { return version; }
+
+    static std::atomic<int>& instances() {
+        static std::atomic<int> instances{0};
+        return instances;
+    }
+
+    int version = 0;
+};
+
+struct static_router : i_router {
+    int route() const override { return 42; }
+};
+
+struct client {
+    explicit client(std::shared_ptr<i_router> r)
+        : r(r)
+    { }
+
+    std::shared_ptr<i_router> r;
+};
+
+auto make_router(int version) {
+    config c;
+    c.version = version;
+    return std::make_shared<router>(c);
+}
+
+test reload_replaces_instance = [] {
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(di::reloadable)
+    );
+
+    auto object1 = injector.create<client>();
+    expect_eq(object1.r, injector.create<std::shared_ptr<i_router>>());
+    expect_eq(1, object1.r->route());
+
+    injector.call(di::reload<i_router>(std::make_shared<static_router>()));
+    auto object2 = injector.create<client>();
+    expect_eq(42, object2.r->route());
+    expect_eq(1, object1.r->route()); // snapshot is kept
+    expect(object1.r != object2.r);
+};
+
+test old_instance_is_released_with_last_snapshot = [] {
+    router::instances() = 0;
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(di::reloadable)
+    );
+
+    std::weak_ptr<i_router> old;
+    {
+    auto object = injector.create<std::shared_ptr<i_router>>();
+    old = object;
+    injector.call(di::reload<i_router>(std::make_shared<static_router>()));
+    expect(!old.expired());
+    }
+
+    expect(old.expired());
+    expect_eq(0, router::instances());
+};
+
+test reload_through_binding = [] {
+    config c;
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(di::reloadable)
+      , di::bind<config>().to(c)
+    );
+
+    expect_eq(1, injector.create<std::shared_ptr<i_router>>()->route());
+
+    c.version = 2;
+    expect_eq(1, injector.create<std::shared_ptr<i_router>>()->route());
+
+    injector.call(di::reload<i_router>());
+    expect_eq(2, injector.create<std::shared_ptr<i_router>>()->route());
+    expect_eq(injector.create<std::shared_ptr<i_router>>(), injector.create<std::shared_ptr<i_router>>());
+};
+
+test reload_by_value = [] {
+    auto injector = di::make_injector(
+        di::bind<config>().in(di::reloadable)
+    );
+
+    expect_eq(1, injector.create<config>().version);
+    auto object = std::make_shared<config>();
+    object->version = 2;
+    injector.call(di::reload<config>(object));
+    expect_eq(2, injector.create<config>().version);
+};
+
+test readers_and_writer = [] {
+    router::instances() = 0;
+    {
+    config c;
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(di::reloadable)
+      , di::bind<config>().to(c)
+    );
+    injector.warm_up();
+
+    constexpr auto reloads = 200;
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (auto i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            auto last = 0;
+            while (!done.load()) {
+                auto object = injector.create<client>();
+                const auto version = object.r->route();
+                if (version == 42) {
+                    continue;
+                }
+                if (version <= 0 || version < last) {
+                    ++failures;
+                }
+                last = version;
+            }
+        });
+    }
+
+    for (auto i = 0; i < reloads; ++i) {
+        if (i % 2) {
+            injector.call(di::reload<i_router>(make_router(i + 1)));
+        } else {
+            injector.call(di::reload<i_router>(std::make_shared<static_router>()));
+        }
+        std::this_thread::yield();
+    }
+    c.version = reloads + 1;
+    injector.call(di::reload<i_router>());
+
+    done = true;
+    for (auto& thread : readers) {
+        thread.join();
+    }
+
+    expect_eq(0, failures.load());
+    expect_eq(1, router::instances());
+    expect_eq(reloads + 1, injector.create<std::shared_ptr<i_router>>()->route());
+    }
+    expect_eq(0, router::instances());
+};
@@ -4,7 +4,10 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 #include "boost/di.hpp"
 
 namespace di = boost::di;
@@ -39,3 +42,91 @@ test session_call = [] {
     }
 };
 
+test session_mt_call_concurrently = [] {
+    constexpr auto readers = 4;
+    constexpr auto toggles = 100;
+
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::session_mt(name))
+    );
+
+    std::atomic<bool> done{false};
+    std::atomic<int> created{0};
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < readers; ++i) {
+        workers.emplace_back([&] {
+            while (!done.load()) {
+                auto object = injector.create<std::shared_ptr<i1>>();
+                if (object) {
+                    object->dummy1();
+                    ++created;
+                }
+            }
+        });
+    }
+
+    for (auto i = 0; i < toggles; ++i) {
+        injector.call(di::session_entry(name));
+        std::this_thread::yield();
+        injector.call(di::session_exit(name));
+    }
+
+    injector.call(di::session_entry(name));
+    auto object1 = injector.create<std::shared_ptr<i1>>();
+    auto object2 = injector.create<std::shared_ptr<i1>>();
+    expect(object1.get());
+    expect(object1 == object2);
+
+    done = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    injector.call(di::session_exit(name));
+    expect(!injector.create<std::shared_ptr<i1>>().get());
+};
+
+
+test session_mt_exit_concurrently_with_create = [] {
+    constexpr auto readers = 4;
+    constexpr auto writers = 2;
+    constexpr auto toggles = 100;
+
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::session_mt(name))
+    );
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            while (!done.load()) {
+                if (auto object = injector.create<std::shared_ptr<i1>>()) {
+                    object->dummy1();
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> exits;
+    for (auto i = 0; i < writers; ++i) {
+        exits.emplace_back([&] {
+            for (auto j = 0; j < toggles; ++j) {
+                injector.call(di::session_entry(name));
+                std::this_thread::yield();
+                injector.call(di::session_exit(name));
+            }
+        });
+    }
+
+    for (auto& exit : exits) {
+        exit.join();
+    }
+
+    done = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    expect(!injector.create<std::shared_ptr<i1>>().get());
+};
@@ -4,7 +4,10 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 #if __has_include(<boost/shared_ptr.hpp>)
     #include <boost/shared_ptr.hpp>
 #endif
@@ -27,3 +30,87 @@ namespace di = boost::di;
     };
 #endif
 
+test shared_mt_create_concurrently = [] {
+    constexpr auto threads = 8;
+
+    struct c {
+        c() { ++ctor_calls(); std::this_thread::yield(); }
+
+        static std::atomic<int>& ctor_calls() {
+            static std::atomic<int> calls{0};
+            return calls;
+        }
+    };
+
+    auto injector = di::make_injector(
+        di::bind<c>().in(di::shared_mt)
+    );
+
+    std::atomic<bool> ready{false};
+    std::vector<c*> objects(threads);
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i] {
+            while (!ready.load()) { }
+            objects[i] = injector.create<std::shared_ptr<c>>().get();
+        });
+    }
+
+    ready = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    expect_eq(1, c::ctor_calls().load());
+    for (const auto& object : objects) {
+        expect_eq(objects[0], object);
+    }
+};
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+struct leaf { };
+
+struct const_ref_shared_ptrs {
+    BOOST_DI_INJECT(const_ref_shared_ptrs, const std::shared_ptr<leaf>& l, const std::shared_ptr<i1>& i)
+        : l(&l), use_count(l.use_count()), i(i)
+    { }
+
+    const std::shared_ptr<leaf>* l = nullptr;
+    long use_count = 0;
+    std::shared_ptr<i1> i;
+};
+
+struct deduced_const_ref_shared_ptrs {
+    deduced_const_ref_shared_ptrs(const std::shared_ptr<leaf>& l, const std::shared_ptr<i1>& i)
+        : l(&l), use_count(l.use_count()), i(i)
+    { }
+
+    const std::shared_ptr<leaf>* l = nullptr;
+    long use_count = 0;
+    std::shared_ptr<i1> i;
+};
+
+test const_ref_shared_ptr_refers_to_kept_instance = [] {
+    auto expect_kept_instance = [](auto scope) {
+        auto injector = di::make_injector(
+            di::bind<leaf>().in(scope)
+          , di::bind<i1, impl1>().in(scope)
+        );
+        const auto& kept = injector.template create<const std::shared_ptr<leaf>&>();
+        expect_eq(1, kept.use_count());
+
+        auto object = injector.template create<const_ref_shared_ptrs>();
+        expect_eq(&kept, object.l);
+        expect_eq(1, object.use_count); // no reference counting
+        expect(object.i.get());
+
+        auto deduced = injector.template create<deduced_const_ref_shared_ptrs>();
+        expect_eq(&kept, deduced.l);
+        expect_eq(1, deduced.use_count);
+        expect_eq(object.i, deduced.i); // different type than the kept one, copied
+    };
+
+    expect_kept_instance(di::shared);
+    expect_kept_instance(di::shared_mt);
+};
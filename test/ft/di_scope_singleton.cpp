@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+
+namespace di = boost::di;
+
+namespace {
+
+constexpr auto threads = 16;
+constexpr auto iterations = 1000;
+
+template<class TFunction>
+void run_concurrently(const TFunction& function) {
+    std::atomic<bool> ready{false};
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i] {
+            while (!ready.load(std::memory_order_acquire)) { }
+            function(i);
+        });
+    }
+    ready.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+
+struct impl1 : i1 {
+    impl1() {
+        ++ctor_calls();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    void dummy1() override { }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+};
+
+test create_singleton_concurrently = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::singleton)
+    );
+
+    std::vector<i1*> objects(threads);
+    std::atomic<int> mismatches{0};
+
+    run_concurrently([&](int thread) {
+        objects[thread] = injector.create<std::shared_ptr<i1>>().get();
+        for (auto i = 0; i < iterations; ++i) {
+            if (injector.create<std::shared_ptr<i1>>().get() != objects[thread]) {
+                ++mismatches;
+            }
+        }
+    });
+
+    expect_eq(1, impl1::ctor_calls().load());
+    expect_eq(0, mismatches.load());
+    for (const auto& object : objects) {
+        expect_eq(objects[0], object);
+    }
+};
+
+struct singleton_c {
+    singleton_c() { ++ctor_calls(); }
+
+    static std::atomic<int>& ctor_calls() {
+        static std::atomic<int> calls{0};
+        return calls;
+    }
+};
+
+test create_singleton_from_many_injectors_concurrently = [] {
+    std::vector<singleton_c*> objects(threads);
+
+    run_concurrently([&](int thread) {
+        auto injector = di::make_injector(
+            di::bind<singleton_c>().in(di::singleton)
+        );
+        objects[thread] = injector.create<std::shared_ptr<singleton_c>>().get();
+    });
+
+    expect_eq(1, singleton_c::ctor_calls().load());
+    for (const auto& object : objects) {
+        expect_eq(objects[0], object);
+    }
+};
+
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <thread>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/scopes/thread_local_scope.hpp"
+
+namespace di = boost::di;
+
+struct i1 { virtual ~i1() noexcept = default; virtual void dummy1() = 0; };
+struct impl1 : i1 { void dummy1() override { } };
+
+test thread_local_scope_per_thread = [] {
+    constexpr auto threads = 4;
+
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+
+    std::vector<std::shared_ptr<i1>> objects(threads);
+    std::vector<std::thread> workers;
+    for (auto i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i] {
+            objects[i] = injector.create<std::shared_ptr<i1>>();
+            expect(objects[i] == injector.create<std::shared_ptr<i1>>());
+            expect(objects[i].get() == &injector.create<i1&>());
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto i = 0; i < threads; ++i) {
+        expect(objects[i].get());
+        for (auto j = i + 1; j < threads; ++j) {
+            expect(objects[i] != objects[j]);
+        }
+    }
+};
+
+struct dependency {
+    dependency() noexcept { }
+    ~dependency() noexcept { alive = false; }
+    bool alive = true;
+};
+
+struct dependent {
+    explicit dependent(dependency& d)
+        : d(d)
+    { }
+
+    ~dependent() noexcept { expect(d.alive); }
+
+    dependency& d;
+};
+
+test thread_local_scope_destroyed_in_dependency_order = [] {
+    auto injector = di::make_injector(
+        di::bind<dependency>().in(di::thread_local_scope)
+      , di::bind<dependent>().in(di::thread_local_scope)
+    );
+
+    std::thread{[&] {
+        auto& object = injector.create<dependent&>();
+        expect(object.d.alive);
+    }}.join();
+};
+
+test thread_local_scope_per_injector = [] {
+    auto injector1 = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+    auto injector2 = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+
+    auto object1 = injector1.create<std::shared_ptr<i1>>();
+    auto object2 = injector2.create<std::shared_ptr<i1>>();
+    expect(object1 != object2);
+    expect(object1 == injector1.create<std::shared_ptr<i1>>());
+    expect(object2 == injector2.create<std::shared_ptr<i1>>());
+
+    auto copy = injector1;
+    expect(object1 == copy.create<std::shared_ptr<i1>>());
+};
+
+test thread_local_scope_alternating_injectors = [] {
+    auto make_injector = [] {
+        return di::make_injector(
+            di::bind<i1, impl1>().in(di::thread_local_scope)
+        );
+    };
+    std::vector<decltype(make_injector())> injectors;
+    for (auto i = 0; i < 6; ++i) { // more than instances cached per thread
+        injectors.push_back(make_injector());
+    }
+
+    std::vector<std::shared_ptr<i1>> objects;
+    for (auto& injector : injectors) {
+        objects.push_back(injector.create<std::shared_ptr<i1>>());
+    }
+
+    for (auto n = 0; n < 3; ++n) {
+        for (auto i = 0u; i < injectors.size(); ++i) {
+            expect(objects[i] == injectors[i].create<std::shared_ptr<i1>>());
+        }
+    }
+};
+
+test thread_local_scope_released_with_injector = [] {
+    std::weak_ptr<i1> object;
+    {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+    object = injector.create<std::shared_ptr<i1>>();
+    expect(!object.expired());
+    }
+    expect(object.expired());
+
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+    expect(injector.create<std::shared_ptr<i1>>() != nullptr);
+};
+
+test thread_local_scope_released_at_thread_exit = [] {
+    auto injector = di::make_injector(
+        di::bind<i1, impl1>().in(di::thread_local_scope)
+    );
+
+    std::weak_ptr<i1> object;
+    std::thread{[&] {
+        object = injector.create<std::shared_ptr<i1>>();
+        expect(!object.expired());
+    }}.join();
+    expect(object.expired());
+};
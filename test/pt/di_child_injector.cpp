@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include "boost/di.hpp"
+#include "boost/di/warm_up.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct context {
+    int id = 0;
+};
+
+template<int>
+struct service {
+    int value = 42;
+};
+
+template<int>
+struct config {
+    std::string value;
+};
+
+struct handler {
+    BOOST_DI_INJECT(handler, const context& ctx, std::shared_ptr<service<0>> s, const config<0>& c)
+        : id(ctx.id + s->value + static_cast<int>(c.value.size()))
+    { }
+
+    int id = 0;
+};
+
+template<int... Ns>
+auto make_parent(std::integer_sequence<int, Ns...>) {
+    return di::make_injector(
+        di::bind<context>().to(context{})
+      , di::bind<service<Ns>>().in(di::shared)...
+      , di::bind<config<Ns>>().to(config<Ns>{"configuration value of a long-living binding"})...
+    );
+}
+
+/**
+ * Parent with 33 bindings (16 `shared`, 17 external), each request overrides the context only
+ */
+test copying_vs_child_injector = [] {
+    auto parent = make_parent(std::make_integer_sequence<int, 16>{});
+    parent.warm_up();
+    const context ctx{1};
+
+    benchmark("request.make_injector(parent, override)", [&] {
+        auto injector = di::make_injector(parent, di::bind<context>().to(ctx)[di::override]);
+        do_not_optimize(injector.create<handler>());
+    });
+
+    benchmark("request.make_child_injector(parent)", [&] {
+        auto injector = di::make_child_injector(parent, di::bind<context>().to(ctx));
+        do_not_optimize(injector.create<handler>());
+    });
+};
@@ -5,6 +5,8 @@
 // (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <boost/di.hpp>
 
 namespace di = boost::di;
@@ -806,6 +808,59 @@ struct module10 {
 };
 #endif
 
+#if defined(BINDINGS)
+/**
+ * -DBINDINGS=N, binary tree of N bound types, z<n> depends on z<2n+1> and z<2n+2>
+ */
+struct leaf { };
+
+template<int> struct z;
+
+template<int N, bool = (N < BINDINGS)>
+struct node { using type = z<N>; };
+
+template<int N>
+struct node<N, false> { using type = leaf; };
+
+template<int N>
+struct z { BOOST_DI_INJECT(z, typename node<2 * N + 1>::type, typename node<2 * N + 2>::type) { } };
+
+template<int... Ns>
+auto make_bindings(std::integer_sequence<int, Ns...>) {
+    return di::make_injector(di::bind<z<Ns>>.in(di::unique)...);
+}
+
+#if defined(INJECTOR)
+/**
+ * -DINJECTOR, builds the injector type only (baseline of -DLOOKUPS)
+ */
+using injector_t = decltype(make_bindings(std::make_integer_sequence<int, BINDINGS>{}));
+static_assert(sizeof(injector_t), "");
+
+int main() { }
+#elif defined(LOOKUPS)
+/**
+ * -DLOOKUPS, builds the injector type and resolves each of N bindings without creating anything
+ */
+template<class TInjector, int... Ns>
+constexpr auto resolve_all(std::integer_sequence<int, Ns...>) {
+    return std::is_same<
+        std::integer_sequence<bool, std::is_reference<di::core::binder::resolve_t<TInjector, z<Ns>>>::value...>
+      , std::integer_sequence<bool, di::aux::always<z<Ns>>::value...>
+    >::value;
+}
+
+using injector_t = decltype(make_bindings(std::make_integer_sequence<int, BINDINGS>{}));
+static_assert(resolve_all<injector_t>(std::make_integer_sequence<int, BINDINGS>{}), "");
+
+int main() { }
+#else
+int main() {
+    auto injector = make_bindings(std::make_integer_sequence<int, BINDINGS>{});
+    injector.create<z<0>>();
+}
+#endif
+#else
 int main() {
     auto injector = di::make_injector(
         #if defined(MODULE1)
@@ -851,4 +906,4 @@ int main() {
 
     injector.create<COMPLEX>();
 }
-
+#endif
@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "common/benchmark.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if !defined(COMPILE_TIME_CXX)
+    #define COMPILE_TIME_CXX "c++"
+#endif
+
+#if !defined(COMPILE_TIME_CXX_ID)
+    #define COMPILE_TIME_CXX_ID "GNU"
+#endif
+
+#if !defined(COMPILE_TIME_SOURCE)
+    #define COMPILE_TIME_SOURCE "pt/di_compile_time.cpp"
+#endif
+
+#if !defined(COMPILE_TIME_INCLUDE)
+    #define COMPILE_TIME_INCLUDE "../include"
+#endif
+
+#if !defined(COMPILE_TIME_THRESHOLDS)
+    #define COMPILE_TIME_THRESHOLDS "pt/di_compile_time.thresholds"
+#endif
+
+#if !defined(COMPILE_TIME_FLAGS)
+    #define COMPILE_TIME_FLAGS ""
+#endif
+
+#if !defined(COMPILE_TIME_BINDINGS)
+    #define COMPILE_TIME_BINDINGS "10 50 100"
+#endif
+
+namespace {
+
+struct compilation {
+    int status = -1;
+    double wall_s = 0.0;
+    double user_s = 0.0;
+    double sys_s = 0.0;
+    double peak_rss_mb = 0.0;
+    std::string output;
+};
+
+struct threshold {
+    double max_wall_s = -1.0;
+    double max_peak_rss_mb = -1.0;
+};
+
+auto env(const char* name, const char* default_value) {
+    auto value = std::getenv(name);
+    return std::string{value && *value ? value : default_value};
+}
+
+auto read_file(const std::string& file) {
+    std::ifstream in{file};
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+/**
+ * Runs the compiler as a child process, peak RSS and cpu time come from its resource usage
+ */
+auto compile(const std::vector<std::string>& args) {
+    using clock = std::chrono::steady_clock;
+    compilation result;
+
+    char output_file[] = "/tmp/di_compile_time_XXXXXX";
+    auto fd = mkstemp(output_file);
+    if (fd == -1) {
+        return result;
+    }
+
+    std::vector<char*> argv;
+    for (const auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    const auto start = clock::now();
+    auto pid = fork();
+    if (!pid) {
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+
+    int status = 0;
+    rusage usage;
+    if (pid > 0 && wait4(pid, &status, 0, &usage) == pid) {
+        result.wall_s = std::chrono::duration<double>(clock::now() - start).count();
+        result.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+        result.user_s = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+        result.sys_s = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+        #if defined(__APPLE__)
+            result.peak_rss_mb = usage.ru_maxrss / (1024.0 * 1024.0); // bytes
+        #else
+            result.peak_rss_mb = usage.ru_maxrss / 1024.0; // kilobytes
+        #endif
+    }
+
+    close(fd);
+    result.output = read_file(output_file);
+    std::remove(output_file);
+    return result;
+}
+
+/**
+ * gcc -ftime-report, ex. " phase parsing : 1.57 ( 92%) 0.64 ( 93%) 2.24 ( 93%) 260M ( 95%)"
+ */
+auto gcc_phases(const std::string& output) {
+    static const std::vector<std::pair<std::string, std::string>> phases = {
+        {"phase setup", "setup"}
+      , {"phase parsing", "parsing"}
+      , {"phase lang. deferred", "lang_deferred"}
+      , {"phase opt and generate", "opt_and_generate"}
+      , {"template instantiation", "template_instantiation"}
+    };
+
+    std::map<std::string, double> result;
+    std::istringstream lines{output};
+    std::string line;
+    while (std::getline(lines, line)) {
+        auto colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        auto name = line.substr(0, colon);
+        name.erase(0, name.find_first_not_of(' '));
+        name.erase(name.find_last_not_of(' ') + 1);
+        for (const auto& phase : phases) {
+            if (name == phase.first) {
+                double usr = 0.0, sys = 0.0, wall = 0.0;
+                if (std::sscanf(line.c_str() + colon + 1, "%lf (%*[^)]) %lf (%*[^)]) %lf", &usr, &sys, &wall) == 3) {
+                    result[phase.second] = wall;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * clang -ftime-trace, ex. {"ph":"X","dur":1234,"name":"Total InstantiateClass","args":{"count":42,...}}
+ */
+auto clang_event(const std::string& trace, const std::string& name, const char* field) {
+    auto pos = trace.find("\"name\":\"" + name + "\"");
+    if (pos == std::string::npos) {
+        return -1.0;
+    }
+    const auto begin = trace.rfind('{', pos);
+    const auto end = trace.find("}}", pos);
+    const auto event = trace.substr(begin, end - begin);
+    const auto value = event.find(std::string{"\""} + field + "\":");
+    return value == std::string::npos ? -1.0 : std::atof(event.c_str() + value + std::strlen(field) + 3);
+}
+
+auto clang_phases(const std::string& trace) {
+    std::map<std::string, double> result;
+    for (const auto& phase : {"Frontend", "Backend", "Source", "InstantiateClass", "InstantiateFunction"}) {
+        const auto dur = clang_event(trace, std::string{"Total "} + phase, "dur");
+        if (dur >= 0) {
+            result[phase] = dur / 1e6; // microseconds
+        }
+    }
+    return result;
+}
+
+auto read_thresholds(const std::string& file) {
+    std::map<int, threshold> result;
+    std::ifstream in{file};
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        int bindings = 0;
+        threshold t;
+        std::istringstream{line} >> bindings >> t.max_wall_s >> t.max_peak_rss_mb;
+        result[bindings] = t;
+    }
+    return result;
+}
+
+auto json_number(double value) {
+    char buffer[32];
+    value < 0 ? std::snprintf(buffer, sizeof(buffer), "null") : std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return std::string{buffer};
+}
+
+auto json_object(const std::map<std::string, double>& values) {
+    std::string result = "{";
+    for (const auto& value : values) {
+        result += (result.size() > 1 ? ", \"" : "\"") + value.first + "\": " + json_number(value.second);
+    }
+    return result + "}";
+}
+
+void report(int bindings, const compilation& c, const std::map<std::string, double>& phases
+          , const std::map<std::string, double>& instantiations, const threshold& t, bool regression) {
+    const auto name = "compile_time.bindings_" + std::to_string(bindings);
+    if (benchmark_json()) {
+        std::printf("{\"name\": \"%s\", \"bindings\": %d, \"wall_s\": %s, \"user_s\": %s, \"sys_s\": %s, \"peak_rss_mb\": %s"
+                    ", \"phases\": %s, \"instantiations\": %s, \"max_wall_s\": %s, \"max_peak_rss_mb\": %s, \"regression\": %s}\n"
+                  , name.c_str(), bindings, json_number(c.wall_s).c_str(), json_number(c.user_s).c_str(), json_number(c.sys_s).c_str()
+                  , json_number(c.peak_rss_mb).c_str(), json_object(phases).c_str()
+                  , instantiations.empty() ? "null" : json_object(instantiations).c_str()
+                  , json_number(t.max_wall_s).c_str(), json_number(t.max_peak_rss_mb).c_str(), regression ? "true" : "false");
+    } else {
+        std::printf("%-56s %10.2f s %10.1f MB%s\n", name.c_str(), c.wall_s, c.peak_rss_mb, regression ? " REGRESSION" : "");
+    }
+    std::fflush(stdout);
+}
+
+} // namespace
+
+test compile_time = [] {
+    const std::string cxx_id = COMPILE_TIME_CXX_ID;
+    const auto clang = cxx_id.find("Clang") != std::string::npos;
+    const auto thresholds = read_thresholds(env("COMPILE_TIME_THRESHOLDS", COMPILE_TIME_THRESHOLDS));
+    const auto object = std::string{"/tmp/di_compile_time_"} + std::to_string(getpid()) + ".o";
+
+    std::istringstream scales{env("COMPILE_TIME_BINDINGS", COMPILE_TIME_BINDINGS)};
+    int bindings = 0;
+    while (scales >> bindings) {
+        std::vector<std::string> args = {
+            COMPILE_TIME_CXX, "-std=c++1y", "-O2", "-I", COMPILE_TIME_INCLUDE
+          , "-DBINDINGS=" + std::to_string(bindings)
+          , "-ftemplate-depth=" + std::to_string(bindings + 100)
+          , clang ? "-ftime-trace" : "-ftime-report"
+          , "-c", COMPILE_TIME_SOURCE, "-o", object
+        };
+        std::istringstream flags{env("COMPILE_TIME_FLAGS", COMPILE_TIME_FLAGS)}; // ex. -DBOOST_DI_CFG_CTOR_LIMIT_SIZE=20
+        for (std::string flag; flags >> flag;) {
+            args.push_back(flag);
+        }
+
+        auto c = compile(args);
+        expect(!c.status);
+        if (c.status) {
+            std::fprintf(stderr, "%s\n", c.output.c_str());
+            break;
+        }
+
+        std::map<std::string, double> phases, instantiations;
+        if (clang) {
+            const auto trace_file = object.substr(0, object.size() - 2) + ".json";
+            const auto trace = read_file(trace_file);
+            phases = clang_phases(trace);
+            instantiations["class"] = clang_event(trace, "Total InstantiateClass", "count");
+            instantiations["function"] = clang_event(trace, "Total InstantiateFunction", "count");
+            std::remove(trace_file.c_str());
+        } else {
+            phases = gcc_phases(c.output); // gcc doesn't report the number of instantiations
+        }
+
+        const auto t = thresholds.count(bindings) ? thresholds.at(bindings) : threshold{};
+        const auto regression = (t.max_wall_s >= 0 && c.wall_s > t.max_wall_s) ||
+                                (t.max_peak_rss_mb >= 0 && c.peak_rss_mb > t.max_peak_rss_mb);
+        report(bindings, c, phases, instantiations, t, regression);
+        expect(!regression);
+    }
+    std::remove(object.c_str());
+};
+
+#endif
@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/providers/contiguous.hpp"
+#include "common/allocations.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+template<int>
+struct service {
+    service() { }
+    int value[4] = {1, 2, 3, 4};
+};
+
+struct request {
+    BOOST_DI_INJECT(request
+      , const std::shared_ptr<service<0>>& s0, const std::shared_ptr<service<1>>& s1
+      , const std::shared_ptr<service<2>>& s2, const std::shared_ptr<service<3>>& s3
+      , const std::shared_ptr<service<4>>& s4, const std::shared_ptr<service<5>>& s5
+      , const std::shared_ptr<service<6>>& s6, const std::shared_ptr<service<7>>& s7)
+        : value(s0->value[0] + s1->value[1] + s2->value[2] + s3->value[3]
+              + s4->value[0] + s5->value[1] + s6->value[2] + s7->value[3])
+    { }
+
+    int value = 0;
+};
+
+template<class TConfig>
+auto make_services_injector() {
+    return di::make_injector<TConfig>(
+        di::bind<service<0>>().in(di::shared), di::bind<service<1>>().in(di::shared)
+      , di::bind<service<2>>().in(di::shared), di::bind<service<3>>().in(di::shared)
+      , di::bind<service<4>>().in(di::shared), di::bind<service<5>>().in(di::shared)
+      , di::bind<service<6>>().in(di::shared), di::bind<service<7>>().in(di::shared)
+    );
+}
+
+/**
+ * Services are created one by one for all injectors, so services of one injector are spread over the heap
+ * unless they are laid out in the block of the injector
+ */
+template<class TConfig>
+void shared_services(const char* name) {
+    constexpr auto instances = 1 << 14;
+    using injector_t = decltype(make_services_injector<TConfig>());
+
+    std::vector<injector_t> injectors;
+    injectors.reserve(instances);
+    for (auto i = 0; i < instances; ++i) {
+        injectors.push_back(make_services_injector<TConfig>());
+    }
+
+    auto create = [&](auto* service) {
+        using service_t = std::remove_pointer_t<decltype(service)>;
+        for (auto& injector : injectors) {
+            injector.template create<std::shared_ptr<service_t>>();
+        }
+    };
+    create((service<0>*)nullptr); create((service<1>*)nullptr);
+    create((service<2>*)nullptr); create((service<3>*)nullptr);
+    create((service<4>*)nullptr); create((service<5>*)nullptr);
+    create((service<6>*)nullptr); create((service<7>*)nullptr);
+
+    std::vector<int> order(instances);
+    std::mt19937 random;
+    for (auto& i : order) {
+        i = std::uniform_int_distribution<int>{0, instances - 1}(random);
+    }
+
+    auto i = 0u;
+    auto sum = 0;
+    benchmark(name, [&] {
+        sum += injectors[order[i++ % instances]].template create<request>().value;
+    });
+    do_not_optimize(sum);
+}
+
+test default_vs_contiguous_shared_services = [] {
+    shared_services<di::config>("shared_services.config");
+    shared_services<di::contiguous_config<>>("shared_services.contiguous_config");
+};
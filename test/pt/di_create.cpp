@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include <utility>
+#include "boost/di.hpp"
+#include "boost/di/providers/heap.hpp"
+#include "common/allocations.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+/**
+ * Chain of `depth` objects, each one depending on the next one
+ */
+template<int N>
+struct node {
+    explicit node(std::shared_ptr<node<N - 1>> next)
+        : next(next)
+    { }
+
+    std::shared_ptr<node<N - 1>> next;
+};
+
+template<>
+struct node<0> {
+    node() { }
+    int value = 42;
+};
+
+auto session_name = []{};
+
+struct runtime_policy {
+    template<class T>
+    void operator()(const T&) const noexcept {
+        do_not_optimize(calls);
+        ++calls;
+    }
+
+    static int calls;
+};
+
+int runtime_policy::calls = 0;
+
+class stack_over_heap_config : public di::config {
+public:
+    auto provider() const noexcept { return di::providers::stack_over_heap{}; }
+};
+
+class heap_config : public di::config {
+public:
+    auto provider() const noexcept { return di::providers::heap{}; }
+};
+
+class stack_over_heap_policies_config : public stack_over_heap_config {
+public:
+    auto policies() const noexcept { return di::make_policies(runtime_policy{}); }
+};
+
+class heap_policies_config : public heap_config {
+public:
+    auto policies() const noexcept { return di::make_policies(runtime_policy{}); }
+};
+
+struct unique_scope {
+    static constexpr auto name = "unique";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...>) {
+        return di::make_injector<TConfig>(di::bind<node<Ns>>().in(di::unique)...);
+    }
+};
+
+struct shared_scope {
+    static constexpr auto name = "shared";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...>) {
+        return di::make_injector<TConfig>(di::bind<node<Ns>>().in(di::shared)...);
+    }
+};
+
+struct singleton_scope {
+    static constexpr auto name = "singleton";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...>) {
+        return di::make_injector<TConfig>(di::bind<node<Ns>>().in(di::singleton)...);
+    }
+};
+
+struct session_scope {
+    static constexpr auto name = "session";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...>) {
+        auto injector = di::make_injector<TConfig>(di::bind<node<Ns>>().in(di::session(session_name))...);
+        injector.call(di::session_entry(session_name));
+        return injector;
+    }
+};
+
+struct external_scope {
+    static constexpr auto name = "external";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...> graph) {
+        constexpr auto depth = sizeof...(Ns) - 1;
+        auto root = unique_scope::make<TConfig>(graph).template create<std::shared_ptr<node<depth>>>();
+        return di::make_injector<TConfig>(di::bind<node<depth>>().to(root));
+    }
+};
+
+struct exposed_scope {
+    static constexpr auto name = "exposed";
+
+    template<class TConfig, int... Ns>
+    static auto make(std::integer_sequence<int, Ns...> graph) {
+        constexpr auto depth = sizeof...(Ns) - 1;
+        return di::make_injector<TConfig>(
+            di::injector<node<depth>>{unique_scope::make<TConfig>(graph)}
+        );
+    }
+};
+
+template<class TScope, class TConfig, int Depth>
+void create(const char* config) {
+    auto injector = TScope::template make<TConfig>(std::make_integer_sequence<int, Depth + 1>{});
+    const auto name = std::string{"create."} + TScope::name + ".depth_" + std::to_string(Depth) + "." + config;
+    benchmark(name.c_str(), [&] {
+        do_not_optimize(injector.template create<std::shared_ptr<node<Depth>>>());
+    }, BENCHMARK_ITERATIONS / (Depth + 1));
+}
+
+template<class TScope, class TConfig>
+void create_depths(const char* config) {
+    create<TScope, TConfig, 1>(config);
+    create<TScope, TConfig, 5>(config);
+    create<TScope, TConfig, 10>(config);
+    create<TScope, TConfig, 25>(config);
+    create<TScope, TConfig, 50>(config);
+}
+
+template<class TScope>
+void create_scope() {
+    create_depths<TScope, stack_over_heap_config>("stack_over_heap");
+    create_depths<TScope, heap_config>("heap");
+    create_depths<TScope, stack_over_heap_policies_config>("stack_over_heap.policies");
+    create_depths<TScope, heap_policies_config>("heap.policies");
+}
+
+test create_unique = [] { create_scope<unique_scope>(); };
+test create_shared = [] { create_scope<shared_scope>(); };
+test create_singleton = [] { create_scope<singleton_scope>(); };
+test create_session = [] { create_scope<session_scope>(); };
+test create_external = [] { create_scope<external_scope>(); };
+test create_exposed = [] { create_scope<exposed_scope>(); };
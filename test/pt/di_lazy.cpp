@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+template<int>
+struct node {
+    int value = 1;
+};
+
+template<int N>
+struct subsystem {
+    BOOST_DI_INJECT(subsystem
+      , std::unique_ptr<node<N * 4>> n0, std::unique_ptr<node<N * 4 + 1>> n1
+      , std::unique_ptr<node<N * 4 + 2>> n2, std::unique_ptr<node<N * 4 + 3>> n3)
+        : value(n0->value + n1->value + n2->value + n3->value)
+    { }
+
+    int value = 0;
+};
+
+template<class T>
+using eager = T;
+
+template<class T>
+using lazy = di::lazy<T>;
+
+template<class T>
+using lazy_mt = di::lazy_mt<T>;
+
+/**
+ * Service depending on 8 subsystems, a request uses only the first one
+ */
+template<template<class> class THandle>
+struct service {
+    BOOST_DI_INJECT(service
+      , THandle<std::unique_ptr<subsystem<0>>> s0, THandle<std::unique_ptr<subsystem<1>>> s1
+      , THandle<std::unique_ptr<subsystem<2>>> s2, THandle<std::unique_ptr<subsystem<3>>> s3
+      , THandle<std::unique_ptr<subsystem<4>>> s4, THandle<std::unique_ptr<subsystem<5>>> s5
+      , THandle<std::unique_ptr<subsystem<6>>> s6, THandle<std::unique_ptr<subsystem<7>>> s7)
+        : s0(std::move(s0)), s1(std::move(s1)), s2(std::move(s2)), s3(std::move(s3))
+        , s4(std::move(s4)), s5(std::move(s5)), s6(std::move(s6)), s7(std::move(s7))
+    { }
+
+    int handle() {
+        return s0->value;
+    }
+
+    THandle<std::unique_ptr<subsystem<0>>> s0; THandle<std::unique_ptr<subsystem<1>>> s1;
+    THandle<std::unique_ptr<subsystem<2>>> s2; THandle<std::unique_ptr<subsystem<3>>> s3;
+    THandle<std::unique_ptr<subsystem<4>>> s4; THandle<std::unique_ptr<subsystem<5>>> s5;
+    THandle<std::unique_ptr<subsystem<6>>> s6; THandle<std::unique_ptr<subsystem<7>>> s7;
+};
+
+template<template<class> class THandle>
+void wide_graph(const char* create, const char* request) {
+    auto injector = di::make_injector();
+
+    benchmark(create, [&] {
+        auto object = injector.template create<service<THandle>>();
+        do_not_optimize(object);
+    });
+
+    benchmark(request, [&] {
+        auto object = injector.template create<service<THandle>>();
+        do_not_optimize(object.handle());
+    });
+}
+
+test eager_vs_lazy_wide_graph = [] {
+    wide_graph<eager>("wide_graph.create.eager", "wide_graph.request.eager");
+    wide_graph<lazy>("wide_graph.create.lazy", "wide_graph.request.lazy");
+    wide_graph<lazy_mt>("wide_graph.create.lazy_mt", "wide_graph.request.lazy_mt");
+};
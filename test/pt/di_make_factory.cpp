@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct i { virtual ~i() noexcept = default; virtual int dummy() = 0; };
+struct impl : i { impl(int i) : i_(i) { }; int dummy() override { return i_; }; int i_ = 0; };
+
+struct repository {
+    repository(std::unique_ptr<i> storage, int size)
+        : storage(std::move(storage)), size(size)
+    { }
+
+    std::unique_ptr<i> storage;
+    int size = 0;
+};
+
+struct service {
+    service(std::unique_ptr<repository> repo, std::unique_ptr<i> logger)
+        : repo(std::move(repo)), logger(std::move(logger))
+    { }
+
+    std::unique_ptr<repository> repo;
+    std::unique_ptr<i> logger;
+};
+
+struct handler {
+    handler(std::unique_ptr<service> s, int id)
+        : s(std::move(s)), id(id)
+    { }
+
+    std::unique_ptr<service> s;
+    int id = 0;
+};
+
+auto expected_handler() {
+    return handler{
+        std::make_unique<service>(
+            std::make_unique<repository>(std::make_unique<impl>(42), 42)
+          , std::make_unique<impl>(42)
+        )
+      , 42
+    };
+}
+
+test make_factory_vs_create_vs_new = [] {
+    auto injector = di::make_injector(
+        di::bind<i, impl>()
+      , di::bind<int>().to(42)
+    );
+    auto factory = injector.make_factory<handler>();
+
+    benchmark("expected (new chain)", [] {
+        do_not_optimize(expected_handler());
+    });
+
+    benchmark("injector.create<handler>", [&] {
+        do_not_optimize(injector.create<handler>());
+    });
+
+    benchmark("injector.make_factory<handler>()()", [&] {
+        do_not_optimize(factory());
+    });
+};
+
+struct counting_policy {
+    template<class T>
+    void operator()(const T&) const noexcept {
+        ++calls;
+    }
+
+    static int calls;
+};
+
+int counting_policy::calls = 0;
+
+class counting_config : public di::config {
+public:
+    auto policies() const noexcept {
+        return di::make_policies(counting_policy{});
+    }
+};
+
+/**
+ * Factory doesn't call policies, unlike `create<T>`
+ */
+test make_factory_vs_create_with_policies = [] {
+    auto injector = di::make_injector<counting_config>(
+        di::bind<i, impl>()
+      , di::bind<int>().to(42)
+    );
+    auto factory = injector.make_factory<handler>();
+
+    benchmark("injector.create<handler> (policies)", [&] {
+        do_not_optimize(injector.create<handler>());
+    });
+
+    benchmark("injector.make_factory<handler>()() (policies)", [&] {
+        do_not_optimize(factory());
+    });
+
+    do_not_optimize(counting_policy::calls);
+};
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include <vector>
+#include "boost/di.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct virtual_dispatch : di::scopes::deduce { };
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+/**
+ * Previous implementation of the exposed scope, module injector is copied per scope copy
+ * and every creation goes through a virtual call
+ */
+template<>
+class exposed<virtual_dispatch> {
+public:
+    template<class TExpected, class TGiven>
+    class scope {
+        using type = std::conditional_t<
+            std::is_copy_constructible<TExpected>::value
+          , TExpected
+          , TExpected*
+        >;
+
+        struct iprovider {
+            virtual ~iprovider() noexcept = default;
+            virtual TExpected* get(const type_traits::heap& = {}) const noexcept = 0;
+            virtual type get(const type_traits::stack&) const noexcept = 0;
+            virtual iprovider* clone() const noexcept = 0;
+
+            std::shared_ptr<TExpected> get(const type_traits::shared_heap&) const noexcept {
+                return std::shared_ptr<TExpected>{get(type_traits::heap{})};
+            }
+        };
+
+        template<class TInjector>
+        class provider_impl : public iprovider {
+        public:
+            explicit provider_impl(const TInjector& injector) noexcept
+                : injector_(injector)
+            { }
+
+            TExpected* get(const type_traits::heap&) const noexcept override {
+                return injector_.create_impl(aux::type<TExpected*>{});
+            }
+
+            type get(const type_traits::stack&) const noexcept override {
+                return injector_.create_impl(aux::type<type>{});
+            }
+
+            iprovider* clone() const noexcept override {
+                return new provider_impl(*this);
+            }
+
+        private:
+            TInjector injector_;
+        };
+
+    public:
+        template<class>
+        using is_referable = std::false_type;
+
+        template<class TInjector>
+        explicit scope(const TInjector& injector) noexcept
+            : provider_{new provider_impl<TInjector>(injector)}
+        { }
+
+        explicit scope(const scope& other) noexcept
+            : provider_(other.provider_->clone())
+        { }
+
+        template<class T, class TProvider>
+        T try_create(const TProvider&);
+
+        template<class T, class TProvider>
+        auto create(const TProvider&) {
+            return scope_.template create<T>(*provider_);
+        }
+
+    private:
+        std::unique_ptr<iprovider> provider_;
+        scopes::deduce::scope<TExpected, TGiven> scope_;
+    };
+};
+
+}}}} // boost::di::v1::scopes
+
+struct i { virtual ~i() noexcept = default; virtual int get() const = 0; };
+struct impl : i { int get() const override { return value; } int value = 42; };
+
+struct config {
+    config() { }
+    std::vector<int> values = std::vector<int>(64, 42);
+};
+
+/**
+ * Module with an external object, exposing `i`
+ */
+auto module() {
+    return di::make_injector(
+        di::bind<i, impl>()
+      , di::bind<config>().to(config{})
+    );
+}
+
+template<class TScope>
+auto make_exposed_injector(const TScope& scope) {
+    return di::make_injector(di::bind<i>().in(scope).to(module()));
+}
+
+template<class TScope>
+void exposed(const char* name, const TScope& scope) {
+    auto injector = make_exposed_injector(scope);
+
+    benchmark((std::string{"exposed.create."} + name).c_str(), [&] {
+        do_not_optimize(injector.template create<std::unique_ptr<i>>());
+    });
+
+    benchmark((std::string{"exposed.copy."} + name).c_str(), [&] {
+        auto copy = injector;
+        do_not_optimize(copy);
+    });
+}
+
+test exposed_function_pointers_vs_virtual = [] {
+    exposed("function_pointers", di::deduce);
+    exposed("virtual", virtual_dispatch{});
+};
+
+struct data {
+    std::shared_ptr<i> sp;
+};
+
+struct service {
+    service(std::unique_ptr<i> object, const config& config)
+        : object(std::move(object)), size(config.values.size())
+    { }
+
+    std::unique_ptr<i> object;
+    std::size_t size = 0;
+};
+
+/**
+ * Module state is shared by all types exposed from one conversion (ex. `exposed_module` from example/modules)
+ */
+template<class... Ts>
+void exposed_module(const char* name) {
+    auto injector = module();
+    benchmark((std::string{"exposed.module."} + name).c_str(), [&] {
+        di::injector<Ts...> exposed = injector;
+        do_not_optimize(exposed);
+    }, BENCHMARK_ITERATIONS / 10);
+}
+
+test exposed_module_state = [] {
+    exposed_module<i>("types_1");
+    exposed_module<i, data, service>("types_3");
+};
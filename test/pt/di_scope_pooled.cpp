@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <thread>
+#include "boost/di.hpp"
+#include "boost/di/scopes/pooled.hpp"
+#include "common/allocations.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct codec {
+    virtual ~codec() noexcept = default;
+    virtual int encode(int) = 0;
+};
+
+struct buffered_codec : codec {
+    int encode(int value) override { return value + buffer[0]; }
+    char buffer[256]{};
+};
+
+/**
+ * Object created for each request and dropped afterwards
+ */
+test unique_vs_pooled_churn = [] {
+    auto unique = di::make_injector(
+        di::bind<codec, buffered_codec>().in(di::unique)
+    );
+
+    benchmark("churn.unique<unique_ptr<codec>>", [&] {
+        auto object = unique.create<std::unique_ptr<codec>>();
+        do_not_optimize(object);
+    });
+
+    auto pooled = di::make_injector(
+        di::bind<codec, buffered_codec>().in(di::pooled)
+    );
+
+    benchmark("churn.pooled<pooled_ptr<codec>>", [&] {
+        auto object = pooled.create<di::pooled_ptr<codec>>();
+        do_not_optimize(object);
+    });
+
+    benchmark("churn.pooled<shared_ptr<codec>>", [&] {
+        auto object = pooled.create<std::shared_ptr<codec>>();
+        do_not_optimize(object);
+    });
+
+    const auto stats = di::pooled.stats<buffered_codec>();
+    std::printf("pooled hit ratio: %.4f\n", stats.hit_ratio());
+};
+
+test pooled_churn_threads = [] {
+    auto injector = di::make_injector(
+        di::bind<codec, buffered_codec>().in(di::pooled)
+    );
+
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+        benchmark_threads("churn.pooled<pooled_ptr<codec>>", threads, [&] {
+            auto object = injector.create<di::pooled_ptr<codec>>();
+            do_not_optimize(object);
+        });
+    }
+};
+
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include "boost/di.hpp"
+#include "boost/di/scopes/reloadable.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct i_router {
+    virtual ~i_router() noexcept = default;
+    virtual int route(int) const = 0;
+};
+
+struct router : i_router {
+    int route(int value) const override { return value + table[value & 63]; }
+    int table[64]{};
+};
+
+template<class TScope>
+void snapshots(const char* name, const TScope& scope) {
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(scope)
+    );
+    injector.template create<std::shared_ptr<i_router>>();
+
+    benchmark(name, [&] {
+        auto object = injector.template create<std::shared_ptr<i_router>>();
+        do_not_optimize(object->route(42));
+    });
+
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+        benchmark_threads(name, threads, [&] {
+            auto object = injector.template create<std::shared_ptr<i_router>>();
+            do_not_optimize(object->route(42));
+        });
+    }
+}
+
+/**
+ * Readers of reloadable instance announce themselves in a counter, `shared_mt` readers don't touch anything but the reference counter
+ */
+test shared_mt_vs_reloadable = [] {
+    snapshots("snapshot.shared_mt", di::shared_mt);
+    snapshots("snapshot.reloadable", di::reloadable);
+};
+
+test reloadable_with_writer = [] {
+    auto injector = di::make_injector(
+        di::bind<i_router, router>().in(di::reloadable)
+    );
+    injector.create<std::shared_ptr<i_router>>();
+
+    std::atomic<bool> done{false};
+    std::atomic<int> reloads{0};
+    std::thread writer{[&] {
+        while (!done.load(std::memory_order_relaxed)) {
+            injector.call(di::reload<i_router>(std::make_shared<router>()));
+            ++reloads;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }};
+
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+        benchmark_threads("snapshot.reloadable+writer", threads, [&] {
+            auto object = injector.create<std::shared_ptr<i_router>>();
+            do_not_optimize(object->route(42));
+        });
+    }
+
+    done = true;
+    writer.join();
+    std::printf("reloads: %d\n", reloads.load());
+};
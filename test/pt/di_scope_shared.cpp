@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "boost/di.hpp"
+#include "common/allocations.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct payload {
+    payload() { }
+    int value = 42;
+    char data[60];
+};
+
+/**
+ * Provider without `shared_heap` support, shared_ptr is created from raw pointer
+ */
+class two_allocations_provider : public di::providers::stack_over_heap {
+public:
+    using stack_over_heap::get;
+
+    template<class, class T, class... TArgs>
+    void get(const di::type_traits::direct&, const di::type_traits::shared_heap&, TArgs&&...) = delete;
+
+    template<class, class T>
+    void get(const di::type_traits::uniform&, const di::type_traits::shared_heap&) = delete;
+};
+
+class two_allocations_config : public di::config {
+public:
+    auto provider() const noexcept {
+        return two_allocations_provider{};
+    }
+};
+
+template<class TConfig>
+auto make_shared_injector() {
+    return di::make_injector<TConfig>(di::bind<payload>().in(di::shared));
+}
+
+template<class TConfig>
+void shared_instance(const char* name) {
+    constexpr auto instances = 1 << 16;
+    using injector_t = decltype(make_shared_injector<TConfig>());
+
+    std::vector<injector_t> injectors;
+    injectors.reserve(instances);
+    std::vector<std::shared_ptr<payload>> objects;
+    objects.reserve(instances);
+
+    for (auto i = 0; i < instances; ++i) {
+        injectors.push_back(make_shared_injector<TConfig>());
+    }
+
+    auto injector = injectors.begin();
+    benchmark((std::string{name} + ".create").c_str(), [&] {
+        objects.push_back((injector++)->template create<std::shared_ptr<payload>>());
+    }, instances);
+
+    std::shuffle(objects.begin(), objects.end(), std::mt19937{});
+    auto i = 0u;
+    auto sum = 0;
+    benchmark((std::string{name} + ".access").c_str(), [&] {
+        std::shared_ptr<payload> object = objects[i++ % instances]; // reference counter and object
+        sum += object->value;
+    });
+    do_not_optimize(sum);
+}
+
+test shared_single_vs_two_allocations = [] {
+    shared_instance<di::config>("shared_heap");
+    shared_instance<two_allocations_config>("heap");
+};
+
+template<int>
+struct leaf {
+    int value = 42;
+};
+
+template<class T>
+using shared_ptr_value = std::shared_ptr<T>;
+
+template<class T>
+using shared_ptr_const_ref = const std::shared_ptr<T>&;
+
+template<template<class> class THandle>
+struct wide {
+    BOOST_DI_INJECT(wide
+      , THandle<leaf<0>> l0, THandle<leaf<1>> l1, THandle<leaf<2>> l2, THandle<leaf<3>> l3
+      , THandle<leaf<4>> l4, THandle<leaf<5>> l5, THandle<leaf<6>> l6, THandle<leaf<7>> l7)
+        : value(l0->value + l1->value + l2->value + l3->value + l4->value + l5->value + l6->value + l7->value)
+    { }
+
+    int value = 0;
+};
+
+template<template<class> class THandle>
+void fan_out(const char* name) {
+    auto injector = di::make_injector(
+        di::bind<leaf<0>>().in(di::shared), di::bind<leaf<1>>().in(di::shared)
+      , di::bind<leaf<2>>().in(di::shared), di::bind<leaf<3>>().in(di::shared)
+      , di::bind<leaf<4>>().in(di::shared), di::bind<leaf<5>>().in(di::shared)
+      , di::bind<leaf<6>>().in(di::shared), di::bind<leaf<7>>().in(di::shared)
+    );
+    injector.template create<wide<THandle>>();
+
+    benchmark(name, [&] {
+        do_not_optimize(injector.template create<wide<THandle>>());
+    });
+}
+
+/**
+ * `const std::shared_ptr<T>&` parameters refer to the kept instance, reference counter isn't touched
+ */
+test shared_ptr_value_vs_const_ref_fan_out = [] {
+    fan_out<shared_ptr_value>("shared_fan_out.shared_ptr");
+    fan_out<shared_ptr_const_ref>("shared_fan_out.const shared_ptr&");
+};
@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include <thread>
+#include "boost/di.hpp"
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct i { virtual ~i() noexcept = default; virtual int dummy() = 0; };
+struct impl : i { int dummy() override { return 0; } };
+
+test singleton_contention = [] {
+    auto injector = di::make_injector(
+        di::bind<i, impl>().in(di::singleton)
+    );
+
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+        benchmark_threads("singleton.create<shared_ptr<i>>", threads, [&] {
+            do_not_optimize(injector.create<std::shared_ptr<i>>());
+        });
+
+        benchmark_threads("singleton.create<i&>", threads, [&] {
+            do_not_optimize(injector.create<i&>());
+        });
+    }
+};
+
+template<class TScope>
+void singleton_storage(const char* name, const TScope& scope) {
+    auto injector = di::make_injector(
+        di::bind<i, impl>().in(scope)
+    );
+    injector.template create<i&>();
+
+    benchmark((std::string{"singleton_storage.create<i&>."} + name).c_str(), [&] {
+        do_not_optimize(injector.template create<i&>());
+    });
+
+    benchmark((std::string{"singleton_storage.create<shared_ptr<i>>."} + name).c_str(), [&] {
+        do_not_optimize(injector.template create<std::shared_ptr<i>>());
+    });
+}
+
+test singleton_process_vs_injector = [] {
+    singleton_storage("singleton", di::singleton);
+    singleton_storage("injector_singleton", di::injector_singleton);
+};
+
+/**
+ * Instances are released together with the injector (one tenant per injector)
+ */
+test injector_singleton_tenants = [] {
+    benchmark("injector_singleton.tenant", [] {
+        auto injector = di::make_injector(
+            di::bind<i, impl>().in(di::injector_singleton)
+        );
+        do_not_optimize(injector.create<i&>());
+    }, BENCHMARK_ITERATIONS / 10);
+};
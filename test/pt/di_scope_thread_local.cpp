@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "boost/di.hpp"
+#include "boost/di/scopes/thread_local_scope.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+struct buffer {
+    buffer() : data(4096) { }
+    std::vector<char> data;
+};
+
+struct cache {
+    cache() { entries.reserve(64); }
+    std::unordered_map<int, std::string> entries;
+};
+
+struct parser {
+    parser(std::shared_ptr<buffer> b, std::shared_ptr<cache> c)
+        : b(b), c(c)
+    { }
+
+    std::shared_ptr<buffer> b;
+    std::shared_ptr<cache> c;
+};
+
+struct handler {
+    handler(std::shared_ptr<parser> p, std::shared_ptr<buffer> b)
+        : p(p), b(b)
+    { }
+
+    std::shared_ptr<parser> p;
+    std::shared_ptr<buffer> b;
+};
+
+template<class TScope>
+auto make_graph_injector(const TScope& scope) {
+    return di::make_injector(
+        di::bind<buffer>().in(scope)
+      , di::bind<cache>().in(scope)
+      , di::bind<parser>().in(scope)
+    );
+}
+
+test thread_local_vs_unique = [] {
+    auto unique = make_graph_injector(di::unique);
+    auto thread_local_scope = make_graph_injector(di::thread_local_scope);
+
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto threads = 1u; threads <= max_threads; threads *= 2) {
+        benchmark_threads("unique.create<handler>", threads, [&] {
+            do_not_optimize(unique.create<handler>());
+        }, BENCHMARK_ITERATIONS / 10);
+
+        benchmark_threads("thread_local_scope.create<handler>", threads, [&] {
+            do_not_optimize(thread_local_scope.create<handler>());
+        }, BENCHMARK_ITERATIONS / 10);
+    }
+};
+
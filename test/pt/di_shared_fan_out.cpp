@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#define BOOST_DI_CFG_LOCAL_SHARED_PTR
+#include <memory>
+#include "boost/di.hpp"
+#include "common/allocations.hpp"
+#include "common/benchmark.hpp"
+
+namespace di = boost::di;
+
+template<int>
+struct leaf {
+    int value = 42;
+};
+
+/**
+ * Every parameter is a handle to a `shared` instance, only the handle type differs
+ */
+template<template<class> class THandle>
+struct wide {
+    BOOST_DI_INJECT(wide
+      , THandle<leaf<0>> l0, THandle<leaf<1>> l1, THandle<leaf<2>> l2, THandle<leaf<3>> l3
+      , THandle<leaf<4>> l4, THandle<leaf<5>> l5, THandle<leaf<6>> l6, THandle<leaf<7>> l7)
+        : value(l0->value + l1->value + l2->value + l3->value + l4->value + l5->value + l6->value + l7->value)
+    { }
+
+    int value = 0;
+};
+
+template<template<class> class THandle>
+void fan_out(const char* name) {
+    auto injector = di::make_injector(
+        di::bind<leaf<0>>().in(di::shared), di::bind<leaf<1>>().in(di::shared)
+      , di::bind<leaf<2>>().in(di::shared), di::bind<leaf<3>>().in(di::shared)
+      , di::bind<leaf<4>>().in(di::shared), di::bind<leaf<5>>().in(di::shared)
+      , di::bind<leaf<6>>().in(di::shared), di::bind<leaf<7>>().in(di::shared)
+    );
+    injector.template create<wide<THandle>>();
+
+    benchmark(name, [&] {
+        do_not_optimize(injector.template create<wide<THandle>>());
+    });
+}
+
+test shared_ptr_vs_local_shared_ptr_fan_out = [] {
+    fan_out<std::shared_ptr>("shared_fan_out.std::shared_ptr");
+    fan_out<di::local_shared_ptr>("shared_fan_out.local_shared_ptr");
+};
+
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <type_traits>
+#include "boost/di/async.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/config.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+struct async_args {
+    async_args(int, double) { }
+};
+
+test is_async_ctor = [] {
+    using direct = type_traits::direct;
+    expect(!core::is_async_ctor<aux::pair<direct, aux::type_list<>>>::value);
+    expect(!core::is_async_ctor<aux::pair<direct, aux::type_list<int>>>::value);
+    expect(!core::is_async_ctor<aux::pair<direct, aux::type_list<int, int>>>::value);
+    expect(core::is_async_ctor<aux::pair<direct, aux::type_list<int, double>>>::value);
+    expect(!core::is_async_ctor<aux::pair<direct, aux::type_list<int, core::any_type_fwd<async_args>>>>::value);
+};
+
+test create_async_single_task = [] {
+    core::injector<di::config> injector{core::init{}};
+    auto tasks = 0;
+    auto future = create_async<int>(injector, [&](const auto& task) { ++tasks; task(); });
+    expect_eq(1, tasks);
+    expect_eq(0, future.get());
+};
+
+test create_async_member = [] {
+    core::injector<di::config> injector{core::init{}};
+    auto tasks = 0;
+    auto future = injector.create_async<int>([&](const auto& task) { ++tasks; task(); });
+    expect_eq(1, tasks);
+    expect_eq(0, future.get());
+};
+
+}}} // boost::di::v1
@@ -82,5 +82,63 @@ test resolve_types_found_priority_order = [] {
 	expect(std::is_same<result, dependency<scopes::unique, int, int, no_name, override>>{});
 };
 
+test resolve_t_types = [] {
+	struct not_resolved { };
+	struct deps
+		: dependency<scopes::unique, int>
+		, dependency<scopes::unique, double, double, no_name, override>
+	{ };
+
+	expect(std::is_same<binder::resolve_t<deps, int>, dependency<scopes::unique, int>&>{});
+	expect(std::is_same<binder::resolve_t<deps, const int&>, dependency<scopes::unique, int>&>{});
+	expect(std::is_same<binder::resolve_t<deps, double>, dependency<scopes::unique, double, double, no_name, override>&>{});
+	expect(std::is_same<binder::resolve_t<deps, float>, dependency<scopes::deduce, float>>{});
+	expect(std::is_same<binder::resolve_t<deps, float, no_name, not_resolved>, not_resolved>{});
+};
+
+test get_resolved = [] {
+	struct deps : dependency<scopes::unique, int> { };
+	deps d;
+	auto&& result = binder::get<binder::resolve_t<deps, int>>(&d);
+	expect(&result == static_cast<dependency<scopes::unique, int>*>(&d));
+	expect(std::is_same<decltype(binder::get<binder::resolve_t<deps, float>>(&d)), dependency<scopes::deduce, float>>{});
+};
+
+test resolve_types_from_parent = [] {
+	struct not_resolved { };
+	struct parent_deps
+		: dependency<scopes::unique, int>
+		, dependency<scopes::unique, double>
+	{ };
+	struct deps
+		: parent<parent_deps>
+		, dependency<scopes::unique, double, double, no_name>
+	{
+		explicit deps(const parent_deps& p)
+			: parent<parent_deps>{p}
+		{ }
+	};
+
+	parent_deps p;
+	deps d{p};
+
+	{
+	using result = decltype(binder::resolve<int>(&d));
+	expect(std::is_same<result, dependency<scopes::unique, int>&>{});
+	expect(static_cast<dependency<scopes::unique, int>*>(&p) == &binder::resolve<int>(&d));
+	}
+
+	{
+	using result = decltype(binder::resolve<double>(&d));
+	expect(std::is_same<result, dependency<scopes::unique, double>&>{});
+	expect(static_cast<dependency<scopes::unique, double>*>(&d) == &binder::resolve<double>(&d));
+	}
+
+	{
+	using result = decltype(binder::resolve<short, no_name, not_resolved>(&d));
+	expect(std::is_same<result, not_resolved>{});
+	}
+};
+
 }}}} // boost::di::v1::core
 
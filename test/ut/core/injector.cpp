@@ -33,6 +33,12 @@ test create = [] {
     expect_eq(0, injector_.create<int>());
 };
 
+test make_factory = [] {
+    injector<di::config> injector_{core::init{}};
+    auto factory = injector_.make_factory<int>();
+    expect_eq(0, factory());
+};
+
 test call = [] {
     fake_scope<>::entry_calls() = 0;
     fake_scope<>::exit_calls() = 0;
@@ -31,5 +31,99 @@ test get_heap = [] {
     expect(ptr.get());
 };
 
+test get_shared_heap = [] {
+    fake_injector<int> injector;
+    provider<int, int, no_name, aux::pair<type_traits::direct, aux::type_list<>>, decltype(injector)> provider{injector};
+    std::shared_ptr<int> ptr = provider.get(type_traits::shared_heap{});
+    expect(ptr.get());
+    expect_eq(1, ptr.use_count());
+};
+
+struct heap_only_provider {
+    template<class...>
+    struct is_creatable {
+        static constexpr auto value = true;
+    };
+
+    template<class, class T, class TInitialization, class... TArgs>
+    T* get(const TInitialization&, const type_traits::heap&, TArgs&&...) const {
+        ++calls();
+        return new T{};
+    }
+
+    static int& calls() {
+        static int calls = 0;
+        return calls;
+    }
+};
+
+struct heap_only_injector : fake_injector<int> {
+    auto provider() const noexcept {
+        return heap_only_provider{};
+    }
+};
+
+test get_shared_heap_fallback_to_heap = [] {
+    heap_only_provider::calls() = 0;
+    heap_only_injector injector;
+    provider<int, int, no_name, aux::pair<type_traits::direct, aux::type_list<>>, decltype(injector)> provider{injector};
+    std::shared_ptr<int> ptr = provider.get(type_traits::shared_heap{});
+    expect(ptr.get());
+    expect_eq(1, heap_only_provider::calls());
+};
+
+inline int& allocator_allocations() {
+    static int allocations = 0;
+    return allocations;
+}
+
+template<class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>&) noexcept { }
+
+    T* allocate(std::size_t size) {
+        ++allocator_allocations();
+        return std::allocator<T>{}.allocate(size);
+    }
+
+    void deallocate(T* ptr, std::size_t size) noexcept {
+        std::allocator<T>{}.deallocate(ptr, size);
+    }
+};
+
+template<class T, class U>
+inline bool operator==(const counting_allocator<T>&, const counting_allocator<U>&) noexcept { return true; }
+
+template<class T, class U>
+inline bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&) noexcept { return false; }
+
+struct allocator_provider : heap_only_provider {
+    counting_allocator<void> allocator() const noexcept {
+        return {};
+    }
+};
+
+struct allocator_injector : fake_injector<int> {
+    auto provider() const noexcept {
+        return allocator_provider{};
+    }
+};
+
+test get_shared_heap_with_provider_allocator = [] {
+    heap_only_provider::calls() = 0;
+    allocator_allocations() = 0;
+    allocator_injector injector;
+    provider<int, int, no_name, aux::pair<type_traits::direct, aux::type_list<>>, decltype(injector)> provider{injector};
+    std::shared_ptr<int> ptr = provider.get(type_traits::shared_heap{});
+    expect(ptr.get());
+    expect_eq(0, heap_only_provider::calls());
+    expect_eq(1, allocator_allocations()); // object and its reference counter at once
+};
+
 }}}} // boost::di::v1::core
 
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <type_traits>
+#include "boost/di/lazy.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+struct object_ {
+    int i = 0;
+};
+
+int calls = 0;
+
+template<class T>
+T create(const void* injector) {
+    ++calls;
+    return *static_cast<const std::remove_reference_t<T>*>(injector);
+}
+
+test value = [] {
+    calls = 0;
+    const object_ given{42};
+    lazy<object_> object{&given, &create<object_>};
+    expect(!object.is_created());
+    expect_eq(0, calls);
+    expect_eq(42, object->i);
+    expect_eq(42, (*object).i);
+    expect_eq(42, object.get().i);
+    expect(object.is_created());
+    expect_eq(1, calls);
+    expect(&given != &object.get());
+};
+
+test reference = [] {
+    calls = 0;
+    const object_ given{42};
+    lazy<const object_&, std::true_type> object{&given, &create<const object_&>};
+    expect_eq(&given, &object.get());
+    expect_eq(&given, object.operator->());
+    expect_eq(1, calls);
+};
+
+test smart_ptr_arrow = [] {
+    calls = 0;
+    const std::shared_ptr<object_> given = std::make_shared<object_>();
+    given->i = 42;
+    lazy<std::shared_ptr<object_>> object{&given, &create<std::shared_ptr<object_>>};
+    expect_eq(42, object->i);
+    expect_eq(given, *object);
+    expect_eq(2, given.use_count());
+};
+
+test move_created = [] {
+    calls = 0;
+    const std::shared_ptr<object_> given = std::make_shared<object_>();
+    lazy_mt<std::shared_ptr<object_>> object{&given, &create<std::shared_ptr<object_>>};
+    object.get();
+
+    auto moved = std::move(object);
+    expect(moved.is_created());
+    expect_eq(given, moved.get());
+    expect_eq(1, calls);
+};
+
+test move_not_created = [] {
+    calls = 0;
+    const object_ given{42};
+    lazy<object_> object{&given, &create<object_>};
+    auto moved = std::move(object);
+    expect(!moved.is_created());
+    expect_eq(42, moved->i);
+    expect_eq(1, calls);
+};
+
+}}} // boost::di::v1
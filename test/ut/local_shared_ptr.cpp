@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di/local_shared_ptr.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+struct i { virtual ~i() noexcept = default; };
+struct impl : i { };
+
+test empty = [] {
+    local_shared_ptr<int> object;
+    expect(!object);
+    expect_eq(nullptr, object.get());
+    expect_eq(0u, object.use_count());
+    expect(!object.to_shared_ptr());
+    expect(!local_shared_ptr<int>{std::shared_ptr<int>{}});
+};
+
+test copies_share_counter = [] {
+    auto sp = std::make_shared<int>(42);
+    local_shared_ptr<int> object{sp};
+    expect_eq(2, sp.use_count());
+    expect_eq(1u, object.use_count());
+
+    {
+    auto copy = object;
+    expect_eq(2u, object.use_count());
+    expect_eq(object.get(), copy.get());
+    expect_eq(42, *copy);
+    expect_eq(2, sp.use_count());
+    }
+
+    expect_eq(1u, object.use_count());
+    object.reset();
+    expect(!object);
+    expect_eq(1, sp.use_count());
+};
+
+test move = [] {
+    local_shared_ptr<int> object{std::make_shared<int>(42)};
+    auto moved = std::move(object);
+    expect(!object);
+    expect_eq(1u, moved.use_count());
+    object = moved;
+    expect_eq(2u, moved.use_count());
+    moved = nullptr;
+    expect_eq(1u, object.use_count());
+};
+
+test convert_to_base = [] {
+    local_shared_ptr<impl> object{std::make_shared<impl>()};
+    local_shared_ptr<i> base = object;
+    expect_eq(2u, object.use_count());
+    expect_eq(static_cast<i*>(object.get()), base.get());
+};
+
+test to_shared_ptr_keeps_object_alive = [] {
+    std::weak_ptr<int> weak;
+    std::shared_ptr<int> sp;
+
+    {
+    local_shared_ptr<int> object{std::make_shared<int>(42)};
+    sp = object.to_shared_ptr();
+    weak = sp;
+    expect_eq(object.get(), sp.get());
+    }
+
+    expect_eq(42, *sp);
+    sp.reset();
+    expect(weak.expired());
+};
+
+test takes_over_unique_ptr = [] {
+    local_shared_ptr<i> object{std::unique_ptr<impl>{new impl{}}};
+    expect(object);
+    expect_eq(1u, object.use_count());
+    expect(!local_shared_ptr<int>{std::unique_ptr<int>{}});
+};
+
+test make_local_shared_keeps_object_in_counters_block = [] {
+    struct object_t {
+        explicit object_t(int& destroyed) noexcept : destroyed(destroyed) { }
+        ~object_t() noexcept { ++destroyed; }
+        int& destroyed;
+    };
+
+    auto destroyed = 0;
+    std::shared_ptr<object_t> sp;
+
+    {
+    auto object = make_local_shared<object_t>(destroyed);
+    expect_eq(1u, object.use_count());
+    auto copy = object;
+    expect_eq(2u, object.use_count());
+    sp = object.to_shared_ptr();
+    expect_eq(object.get(), sp.get());
+    }
+
+    expect_eq(0, destroyed);
+    sp.reset();
+    expect_eq(1, destroyed);
+};
+
+}}} // boost::di::v1
+
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <sstream>
+#include <thread>
+#include "common/fakes/fake_dependency.hpp"
+#include "common/fakes/fake_policy.hpp"
+#include "boost/di/policies/profiler.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace policies {
+
+struct c { int i = 0; };
+
+template<class T>
+void create(const profiler::recorder& recorder) {
+    recorder(fake_policy<T>{}, fake_dependency<c, scopes::deduce>{});
+    recorder.created(fake_policy<T>{}, fake_dependency<c, scopes::deduce>{});
+}
+
+test empty = [] {
+    profiler profiler_;
+    expect(profiler_.snapshot().empty());
+
+    std::stringstream json;
+    profiler_.dump_json(json);
+    expect_eq(std::string{"[]"}, json.str());
+};
+
+test record = [] {
+    profiler profiler_;
+    create<c>(profiler_.policy());
+    create<c>(profiler_.policy());
+    create<std::unique_ptr<c>>(profiler_.policy());
+    create<std::shared_ptr<c>>(profiler_.policy());
+
+    auto snapshot = profiler_.snapshot();
+    expect_eq(2u, snapshot.size());
+
+    expect_eq(3u, snapshot[0].count); // c, unique
+    expect_eq(sizeof(c), snapshot[0].bytes); // std::unique_ptr<c> only
+    expect(profiler::type_name<c>() == snapshot[0].type);
+    expect(snapshot[0].name.empty());
+    expect(profiler::type_name<scopes::unique>() == snapshot[0].scope);
+
+    expect_eq(1u, snapshot[1].count); // c, singleton
+    expect_eq(0u, snapshot[1].bytes);
+    expect(profiler::type_name<scopes::singleton>() == snapshot[1].scope);
+};
+
+test cached = [] {
+    profiler profiler_;
+    auto recorder = profiler_.policy();
+    create<std::shared_ptr<c>>(recorder);
+    recorder(fake_policy<std::shared_ptr<c>>{}, fake_dependency<c, scopes::deduce>{});
+    recorder.cached(fake_policy<std::shared_ptr<c>>{}, fake_dependency<c, scopes::deduce>{});
+    create<c>(recorder);
+
+    auto snapshot = profiler_.snapshot();
+    expect_eq(2u, snapshot.size());
+    expect_eq(1u, snapshot[0].count);
+    expect_eq(0u, snapshot[0].hits);
+    expect_eq(1u, snapshot[1].count);
+    expect_eq(1u, snapshot[1].hits);
+};
+
+test failed = [] {
+    profiler profiler_;
+    auto recorder = profiler_.policy();
+    recorder(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+    recorder.failed(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+    expect(profiler_.snapshot().empty());
+
+    create<c>(recorder);
+    expect_eq(1u, profiler_.snapshot().size());
+};
+
+test deeply_nested = [] {
+    profiler profiler_;
+    auto recorder = profiler_.policy();
+    for (auto i = 0; i <= profiler::max_depth; ++i) {
+        recorder(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+    }
+    for (auto i = 0; i <= profiler::max_depth; ++i) {
+        recorder.created(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+    }
+
+    auto snapshot = profiler_.snapshot();
+    expect_eq(1u, snapshot.size());
+    expect_eq(std::size_t(profiler::max_depth), snapshot[0].count);
+};
+
+test type_name = [] {
+    #if defined(__GNUC__)
+        expect(std::string{"int"} == profiler::type_name<int>());
+        expect(std::string{"boost::di::v1::policies::c"} == profiler::type_name<c>());
+    #else
+        expect(std::string{typeid(int).name()} == profiler::type_name<int>());
+    #endif
+};
+
+test nested = [] {
+    profiler profiler_;
+    auto recorder = profiler_.policy();
+    recorder(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    create<std::unique_ptr<c>>(recorder);
+    recorder.created(fake_policy<c>{}, fake_dependency<c, scopes::deduce>{});
+
+    auto snapshot = profiler_.snapshot();
+    expect_eq(1u, snapshot.size());
+    expect_eq(2u, snapshot[0].count);
+    expect(snapshot[0].total >= std::chrono::milliseconds(1));
+    expect(snapshot[0].max >= std::chrono::milliseconds(1));
+};
+
+test percentile = [] {
+    profiler::binding binding;
+    binding.count = 100;
+    binding.max = std::chrono::nanoseconds{5000};
+    binding.histogram[3] = 90; // < 8ns
+    binding.histogram[10] = 10; // < 1024ns
+
+    expect_eq(8, binding.percentile(0.5).count());
+    expect_eq(8, binding.percentile(0.9).count());
+    expect_eq(1024, binding.percentile(0.99).count());
+    expect_eq(5000, binding.percentile(1.5).count());
+};
+
+test copies_share_statistics = [] {
+    profiler profiler_;
+    auto copy = profiler_;
+    create<c>(copy.policy());
+    expect_eq(1u, profiler_.snapshot().size());
+
+    profiler_.reset();
+    expect(copy.snapshot().empty());
+};
+
+test dump = [] {
+    profiler profiler_;
+    create<c>(profiler_.policy());
+
+    std::stringstream text;
+    profiler_.dump(text);
+    expect(text.str().find("count=1") != std::string::npos);
+
+    std::stringstream json;
+    profiler_.dump_json(json);
+    expect(json.str().find("\"count\":1,") != std::string::npos);
+    expect(json.str().find("\"type\":\"" + profiler::type_name<c>() + "\"") != std::string::npos);
+    expect(json.str().find("\"hits\":0,") != std::string::npos);
+};
+
+test json_string = [] {
+    expect_eq(std::string{"\"\""}, profiler::json_string(""));
+    expect_eq(std::string{"\"ns::c<1>\""}, profiler::json_string("ns::c<1>"));
+    expect_eq(std::string{"\"\\\"a\\\\b\\\"\""}, profiler::json_string("\"a\\b\""));
+    expect_eq(std::string{"\"\\n\\t\\u0001\\u001f\""}, profiler::json_string("\n\t\x01\x1f"));
+};
+
+}}}} // boost::di::v1::policies
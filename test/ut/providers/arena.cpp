@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <cstdint>
+#include "boost/di/aux_/compiler_specific.hpp"
+#include "boost/di/providers/arena.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace providers {
+
+auto is_inside = [](const void* ptr, const void* buffer, std::size_t size) {
+    auto p = reinterpret_cast<std::uintptr_t>(ptr);
+    auto b = reinterpret_cast<std::uintptr_t>(buffer);
+    return p >= b && p < b + size;
+};
+
+test get_heap_from_buffer = [] {
+    struct c { c(int i, double d) : i(i), d(d) { } int i = 0; double d = 0.0; };
+    alignas(std::max_align_t) char buffer[256];
+    arena::monotonic_buffer resource{buffer, sizeof(buffer)};
+
+    {
+    auto object = arena{resource}.get<c, c>(type_traits::direct{}, type_traits::heap{}, 42, 87.0);
+    expect(is_inside(object.get(), buffer, sizeof(buffer)));
+    expect_eq(42, object->i);
+    expect_eq(87.0, object->d);
+    }
+
+    {
+    auto object = arena{resource}.get<c, c>(type_traits::uniform{}, type_traits::heap{}, 1, 2.0);
+    expect(is_inside(object.get(), buffer, sizeof(buffer)));
+    expect_eq(1, object->i);
+    }
+};
+
+test instances_kept_by_scopes_are_not_creatable = [] {
+    struct c { };
+    expect(arena::is_creatable<type_traits::direct, type_traits::heap, c>::value);
+    expect(!arena::is_creatable<type_traits::direct, type_traits::shared_heap, c>::value);
+    expect(!arena::is_creatable<type_traits::direct, type_traits::local_shared_heap, c>::value);
+};
+
+test get_stack = [] {
+    arena::monotonic_buffer resource;
+    arena provider{resource};
+    expect_eq(42, (provider.get<int, int>(type_traits::direct{}, type_traits::stack{}, 42)));
+    expect_eq(87, (provider.get<int, int>(type_traits::uniform{}, type_traits::stack{}, 87)));
+};
+
+test deleter_calls_destructor = [] {
+    static auto dtors = 0;
+    struct c { ~c() { ++dtors; } };
+    arena::monotonic_buffer resource;
+
+    dtors = 0;
+    {
+    auto object = arena{resource}.get<c, c>(type_traits::direct{}, type_traits::heap{});
+    expect_eq(0, dtors);
+    }
+    expect_eq(1, dtors);
+};
+
+test allocations_are_aligned = [] {
+    struct alignas(32) c { char data[3]; };
+    alignas(std::max_align_t) char buffer[256];
+    arena::monotonic_buffer resource{buffer, sizeof(buffer)};
+    arena provider{resource};
+
+    auto c1 = provider.get<char, char>(type_traits::direct{}, type_traits::heap{});
+    auto c2 = provider.get<c, c>(type_traits::direct{}, type_traits::heap{});
+    auto c3 = provider.get<c, c>(type_traits::direct{}, type_traits::heap{});
+
+    expect_eq(0u, reinterpret_cast<std::uintptr_t>(c2.get()) % 32);
+    expect_eq(0u, reinterpret_cast<std::uintptr_t>(c3.get()) % 32);
+    expect(static_cast<void*>(c1.get()) != static_cast<void*>(c2.get()));
+    expect(c2.get() != c3.get());
+};
+
+test grow_over_buffer_and_release = [] {
+    alignas(std::max_align_t) char buffer[16];
+    arena::monotonic_buffer resource{buffer, sizeof(buffer)};
+
+    auto p1 = resource.allocate(8, 8);
+    expect(is_inside(p1, buffer, sizeof(buffer)));
+    auto p2 = resource.allocate(64, 8);
+    expect(!is_inside(p2, buffer, sizeof(buffer)));
+    auto p3 = resource.allocate(1024, 8);
+    expect(p3 && p3 != p2);
+
+    resource.release();
+    expect_eq(p1, resource.allocate(8, 8));
+};
+
+test default_buffer_uses_chunks = [] {
+    arena::monotonic_buffer resource{16};
+    auto p1 = resource.allocate(8, 8);
+    auto p2 = resource.allocate(8, 8);
+    auto p3 = resource.allocate(8, 8);
+    expect(p1 && p2 && p3);
+    expect(p1 != p2 && p2 != p3);
+};
+
+}}}} // boost::di::v1::providers
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "boost/di/providers/contiguous.hpp"
+#include "boost/di/type_traits/memory_traits.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace providers {
+
+struct c { c(int i, double d) : i(i), d(d) { } int i = 0; double d = 0.0; };
+struct a { int i = 0; };
+struct big { char data[1024]; };
+
+using contiguous_t = contiguous<aux::type_list<c, a, big>>;
+
+struct storage {
+    storage()
+        : object(aux::contiguous_storage::make(contiguous_t::slots(), contiguous_t::size()))
+    { }
+
+    ~storage() noexcept {
+        object->release();
+    }
+
+    aux::contiguous_storage* object = nullptr;
+};
+
+test layout = [] {
+    static_assert(3 == contiguous_t::slots(), "");
+    static_assert(0 == contiguous_t::offset(0), "");
+    static_assert(contiguous_t::slot_size(0) == contiguous_t::offset(1), "");
+    static_assert(sizeof(big) < contiguous_t::slot_size(2), "");
+    static_assert(0 == contiguous_t::slot_size(0) % alignof(std::max_align_t), "");
+    static_assert(contiguous_t::offset(3) == contiguous_t::size(), "");
+
+    storage s;
+    expect_eq(contiguous_t::size(), s.object->size());
+    expect_eq(0u, reinterpret_cast<std::uintptr_t>(s.object->data()) % aux::contiguous_storage::cache_line);
+};
+
+test get_shared_in_slot = [] {
+    storage s;
+    std::shared_ptr<c> object = contiguous_t{s.object}.get<c, c>(type_traits::direct{}, type_traits::shared_heap{}, 42, 87.0);
+    expect(s.object->contains(object.get()));
+    expect_eq(42, object->i);
+    expect_eq(87.0, object->d);
+
+    std::shared_ptr<a> uniform = contiguous_t{s.object}.get<a, a>(type_traits::uniform{}, type_traits::shared_heap{}, 42);
+    expect(s.object->contains(uniform.get()));
+    expect_eq(42, uniform->i);
+};
+
+test slot_in_use = [] {
+    storage s;
+    std::shared_ptr<a> object1 = contiguous_t{s.object}.get<a, a>(type_traits::uniform{}, type_traits::shared_heap{});
+    std::shared_ptr<a> object2 = contiguous_t{s.object}.get<a, a>(type_traits::uniform{}, type_traits::shared_heap{});
+    expect(s.object->contains(object1.get()));
+    expect(!s.object->contains(object2.get()));
+
+    auto ptr = object1.get();
+    object1.reset();
+    std::shared_ptr<a> object3 = contiguous_t{s.object}.get<a, a>(type_traits::uniform{}, type_traits::shared_heap{});
+    expect_eq(ptr, object3.get());
+};
+
+test objects_outlive_provider = [] {
+    std::shared_ptr<c> object;
+    {
+    storage s;
+    object = contiguous_t{s.object}.get<c, c>(type_traits::direct{}, type_traits::shared_heap{}, 42, 87.0);
+    }
+    expect_eq(42, object->i);
+};
+
+test other_types_and_memory = [] {
+    storage s;
+    struct other { int i = 0; };
+
+    std::shared_ptr<other> object1 = contiguous_t{s.object}.get<other, other>(type_traits::uniform{}, type_traits::shared_heap{});
+    expect(!s.object->contains(object1.get()));
+
+    std::unique_ptr<c> object2{contiguous_t{s.object}.get<c, c>(type_traits::direct{}, type_traits::heap{}, 42, 87.0)};
+    expect(!s.object->contains(object2.get()));
+    expect_eq(42, object2->i);
+
+    expect_eq(42, (contiguous_t{s.object}.get<a, a>(type_traits::uniform{}, type_traits::stack{}, 42).i));
+};
+
+struct empty { };
+struct with_vtable { virtual ~with_vtable() noexcept = default; char c = 0; };
+struct alignas(alignof(std::max_align_t)) max_aligned { char c = 0; };
+
+using laid_out_t = contiguous<aux::type_list<char, int, double, long double, std::string, empty, with_vtable, max_aligned, c, big>>;
+
+template<class T>
+void expect_in_slot(aux::contiguous_storage* storage, T* object) {
+    expect(storage->contains(object));
+}
+
+template<class... Ts>
+void expect_in_slots(aux::contiguous_storage* storage, const aux::type_list<Ts...>&) {
+    int _[]{0, (expect_in_slot(storage, laid_out_t{storage}.get<Ts, Ts>(type_traits::direct{}, type_traits::shared_heap{}).get()), 0)...}; (void)_;
+}
+
+test laid_out_types_use_slots = [] { // fails when the reference counter of the standard library is bigger than estimated
+    auto storage = aux::contiguous_storage::make(laid_out_t::slots(), laid_out_t::size());
+    expect_in_slots(storage, aux::type_list<char, int, double, long double, std::string, empty, with_vtable, max_aligned>{});
+    storage->release();
+};
+
+}}}} // boost::di::v1::providers
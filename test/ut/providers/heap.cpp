@@ -41,5 +41,13 @@ test get_with_args = [] {
 #endif
 };
 
+test get_shared_heap = [] {
+    struct c { c(int i) : i(i) { } int i = 0; };
+    std::shared_ptr<c> object = heap{}.get<c, c>(type_traits::direct{}, type_traits::shared_heap{}, 42);
+    expect(object.get());
+    expect_eq(42, object->i);
+    expect_eq(1, object.use_count());
+};
+
 }}}} // boost::di::v1::providers
 
@@ -15,6 +15,13 @@ auto test_heap = [](auto type, auto init, auto... args) {
     expect(object.get());
 };
 
+auto test_shared_heap = [](auto type, auto... args) {
+    using T = typename decltype(type)::type;
+    std::shared_ptr<T> object = stack_over_heap{}.get<T, T>(type_traits::direct{}, type_traits::shared_heap{}, args...);
+    expect(object.get());
+    expect_eq(1, object.use_count());
+};
+
 auto test_stack = [](auto type, auto init, auto... args) {
     using T = typename decltype(type)::type;
     T object = stack_over_heap{}.get<T, T>(init, type_traits::stack{}, args...);
@@ -28,6 +35,7 @@ test get_no_args = [] {
     test_stack(test_type<int>{}, type_traits::uniform{});
     test_heap(test_type<c>{}, type_traits::direct{});
     test_stack(test_type<c>{}, type_traits::direct{});
+    test_shared_heap(test_type<c>{});
     test_heap(test_type<c>{}, type_traits::uniform{});
     test_stack(test_type<c>{}, type_traits::uniform{});
 };
@@ -36,11 +44,19 @@ test get_with_args = [] {
     struct direct { direct(int, double) { } };
     struct uniform { int i = 0; double d = 0.0; };
     test_stack(test_type<direct>{}, type_traits::direct{}, int{}, double{});
+    test_shared_heap(test_type<direct>{}, int{}, double{});
     test_heap(test_type<direct>{}, type_traits::uniform{}, int{}, double{});
 #if !defined(BOOST_DI_MSVC)
     test_heap(test_type<uniform>{}, type_traits::uniform{}, int{}, double{});
 #endif
 };
 
+test get_shared_heap_uniform_no_args = [] {
+    struct c { int i = 42; };
+    std::shared_ptr<c> object = stack_over_heap{}.get<c, c>(type_traits::uniform{}, type_traits::shared_heap{});
+    expect(object.get());
+    expect_eq(42, object->i);
+};
+
 }}}} // boost::di::v1::providers
 
@@ -34,5 +34,21 @@ test create_shared = [] {
     expect(!i);
 };
 
+test copy_shares_injector = [] {
+    struct copy_counting_injector : fake_injector<int> {
+        copy_counting_injector() noexcept { }
+        copy_counting_injector(const copy_counting_injector&) noexcept { ++copies(); }
+        static int& copies() noexcept { static auto calls = 0; return calls; }
+    };
+
+    exposed<>::scope<int, int> scope{copy_counting_injector{}};
+    expect_eq(1, copy_counting_injector::copies());
+
+    exposed<>::scope<int, int> copy{scope};
+    exposed<>::scope<int, int> copy_of_copy{copy};
+    expect_eq(1, copy_counting_injector::copies());
+    expect_eq(0, static_cast<int>(copy_of_copy.create<int>(fake_provider<int>{})));
+};
+
 }}}} // boost::di::v1::scopes
 
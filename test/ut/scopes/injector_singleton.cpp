@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "boost/di/scopes/injector_singleton.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+template<class T>
+struct fake_slots_injector : injector_singleton::slot<T, T, no_name> {
+    template<class TSlot>
+    TSlot& slot() const noexcept {
+        return static_cast<TSlot&>((fake_slots_injector&)*this);
+    }
+};
+
+template<class T>
+struct fake_slots_provider : fake_provider<T> {
+    using name = no_name;
+
+    explicit fake_slots_provider(const fake_slots_injector<T>& injector)
+        : injector_(injector)
+    { }
+
+    const fake_slots_injector<T>& injector_;
+};
+
+test create_injector_singleton = [] {
+    fake_slots_injector<int> injector;
+    injector_singleton::scope<int, int> singleton;
+
+    std::shared_ptr<int> object1 = singleton.create<int>(fake_slots_provider<int>{injector});
+    std::shared_ptr<int> object2 = singleton.create<int>(fake_slots_provider<int>{injector});
+
+    expect_eq(object1, object2);
+};
+
+test create_injector_singleton_per_injector = [] {
+    struct c { };
+    fake_slots_injector<c> injector1;
+    fake_slots_injector<c> injector2;
+    injector_singleton::scope<c, c> singleton;
+    fake_provider<c>::provide_calls() = 0;
+
+    std::shared_ptr<c> object1 = singleton.create<c>(fake_slots_provider<c>{injector1});
+    std::shared_ptr<c> object2 = singleton.create<c>(fake_slots_provider<c>{injector2});
+    std::shared_ptr<c> object3 = singleton.create<c>(fake_slots_provider<c>{injector1});
+
+    expect(object1 != object2);
+    expect_eq(object1, object3);
+    expect_eq(2, fake_provider<c>::provide_calls());
+};
+
+test copy_slot_shares_created_instance = [] {
+    fake_slots_injector<int> injector;
+    injector_singleton::scope<int, int> singleton;
+
+    auto empty = injector;
+    std::shared_ptr<int> object = singleton.create<int>(fake_slots_provider<int>{injector});
+    auto copy = injector;
+
+    expect_eq(object, static_cast<std::shared_ptr<int>>(singleton.create<int>(fake_slots_provider<int>{copy})));
+    expect(object != static_cast<std::shared_ptr<int>>(singleton.create<int>(fake_slots_provider<int>{empty})));
+};
+
+}}}} // boost::di::v1::scopes
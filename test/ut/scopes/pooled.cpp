@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include <vector>
+#include "boost/di/scopes/pooled.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+template<int>
+struct entity {
+    int value = 0;
+};
+
+struct reset {
+    template<class T>
+    void operator()(T& object) const noexcept {
+        object.value = 0;
+    }
+};
+
+test create_pooled = [] {
+    using pooled_t = pooled<>;
+    pooled_t::scope<entity<0>, entity<0>> pooled;
+    fake_provider<entity<0>>::provide_calls() = 0;
+
+    entity<0>* first = nullptr;
+    {
+    pooled_ptr<entity<0>> object1 = pooled.create<pooled_ptr<entity<0>>>(fake_provider<entity<0>>{});
+    pooled_ptr<entity<0>> object2 = pooled.create<pooled_ptr<entity<0>>>(fake_provider<entity<0>>{});
+    expect_neq(object1.get(), object2.get());
+    expect_eq(2, fake_provider<entity<0>>::provide_calls());
+    first = object1.get();
+    }
+
+    pooled_ptr<entity<0>> object3 = pooled.create<pooled_ptr<entity<0>>>(fake_provider<entity<0>>{});
+    expect_eq(first, object3.get()); // last returned is reused first
+    expect_eq(2, fake_provider<entity<0>>::provide_calls());
+
+    const auto stats = pooled_t::stats<entity<0>>();
+    expect_eq(1u, stats.hits);
+    expect_eq(2u, stats.misses);
+    expect_eq(0u, stats.drops);
+    expect_eq(1.0 / 3, stats.hit_ratio());
+};
+
+test create_pooled_shared_ptr = [] {
+    pooled<>::scope<entity<1>, entity<1>> pooled;
+    fake_provider<entity<1>>::provide_calls() = 0;
+
+    entity<1>* first = nullptr;
+    {
+    std::shared_ptr<entity<1>> object = pooled.create<std::shared_ptr<entity<1>>>(fake_provider<entity<1>>{});
+    first = object.get();
+    }
+
+    std::shared_ptr<entity<1>> object = pooled.create<std::shared_ptr<entity<1>>>(fake_provider<entity<1>>{});
+    expect_eq(first, object.get());
+    expect_eq(1, fake_provider<entity<1>>::provide_calls());
+};
+
+test pooled_reset = [] {
+    pooled<reset>::scope<entity<2>, entity<2>> pooled;
+
+    {
+    pooled_ptr<entity<2>> object = pooled.create<pooled_ptr<entity<2>>>(fake_provider<entity<2>>{});
+    object->value = 42;
+    }
+
+    pooled_ptr<entity<2>> object = pooled.create<pooled_ptr<entity<2>>>(fake_provider<entity<2>>{});
+    expect_eq(0, object->value);
+};
+
+test pooled_capacity = [] {
+    using pooled_t = pooled<no_reset, 2, 2>;
+    pooled_t::scope<entity<3>, entity<3>> pooled;
+
+    {
+    std::vector<pooled_ptr<entity<3>>> objects;
+    for (auto i = 0; i < 8; ++i) {
+        objects.push_back(pooled.create<pooled_ptr<entity<3>>>(fake_provider<entity<3>>{}));
+    }
+    }
+
+    const auto stats = pooled_t::stats<entity<3>>();
+    expect_eq(0u, stats.hits);
+    expect_eq(8u, stats.misses);
+    expect_eq(4u, stats.drops); // 2 kept by the thread, 2 by the pool
+};
+
+test pooled_deleter_without_pool = [] {
+    pooled_ptr<entity<4>> object{new entity<4>{}};
+    expect(object.get());
+};
+
+}}}} // boost::di::v1::scopes
+
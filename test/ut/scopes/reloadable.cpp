@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <memory>
+#include "boost/di/scopes/reloadable.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+test create_reloadable = [] {
+    reloadable::scope<int, int> reloadable;
+
+    std::shared_ptr<int> object1 = reloadable.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2 = reloadable.create<int>(fake_provider<int>{});
+
+    expect_eq(object1, object2);
+};
+
+test reload_object = [] {
+    reloadable::scope<int, int> reloadable;
+    std::shared_ptr<int> object1 = reloadable.create<int>(fake_provider<int>{});
+
+    auto object = std::make_shared<int>(42);
+    reloadable.call(reload<int>{object});
+    std::shared_ptr<int> object2 = reloadable.create<int>(fake_provider<int>{});
+
+    expect(object1 != object2);
+    expect_eq(object, object2);
+    expect_eq(42, *object2);
+};
+
+test reload_through_provider = [] {
+    reloadable::scope<int, int> reloadable;
+    fake_provider<int>::provide_calls() = 0;
+    std::shared_ptr<int> object1 = reloadable.create<int>(fake_provider<int>{});
+
+    reloadable.call(reload<int>{});
+    expect_eq(1, fake_provider<int>::provide_calls());
+
+    std::shared_ptr<int> object2 = reloadable.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object3 = reloadable.create<int>(fake_provider<int>{});
+
+    expect(object1 != object2);
+    expect_eq(object2, object3);
+    expect_eq(2, fake_provider<int>::provide_calls());
+};
+
+test reload_before_create = [] {
+    reloadable::scope<int, int> reloadable;
+    fake_provider<int>::provide_calls() = 0;
+
+    reloadable.call(reload<int>{});
+    std::shared_ptr<int> object1 = reloadable.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2 = reloadable.create<int>(fake_provider<int>{});
+
+    expect_eq(object1, object2);
+    expect_eq(1, fake_provider<int>::provide_calls());
+};
+
+test copy_reloadable = [] {
+    reloadable::scope<int, int> reloadable1;
+    std::shared_ptr<int> object1 = reloadable1.create<int>(fake_provider<int>{});
+
+    reloadable::scope<int, int> reloadable2{reloadable1};
+    std::shared_ptr<int> object2 = reloadable2.create<int>(fake_provider<int>{});
+    expect_eq(object1, object2);
+
+    reloadable2.call(reload<int>{std::make_shared<int>(42)});
+    expect_eq(object1, static_cast<std::shared_ptr<int>>(reloadable1.create<int>(fake_provider<int>{})));
+    expect_eq(42, *static_cast<std::shared_ptr<int>>(reloadable2.create<int>(fake_provider<int>{})));
+};
+
+}}}} // boost::di::v1::scopes
@@ -46,5 +46,49 @@ test call = [] {
     expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s.create<int>(fake_provider<int>{})));
 };
 
+test exit_keeps_created_instance = [] {
+    static_assert(!session<>::scope<int, int>::is_referable<const std::shared_ptr<int>&>::value, "");
+    session<>::scope<int, int> s;
+    s.call(session_entry<>{});
+    auto object = s.create<int>(fake_provider<int>{});
+    s.call(session_exit<>{});
+    const std::shared_ptr<int>& ref = object;
+    expect_neq(nullptr, ref);
+};
+
+test call_mt = [] {
+    struct name { };
+    session_mt<name>::scope<int, int> s;
+    expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s.create<int>(fake_provider<int>{})));
+    s.call(session_entry<name>{});
+    std::shared_ptr<int> object1 = s.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2 = s.create<int>(fake_provider<int>{});
+    expect_neq(nullptr, object1);
+    expect_eq(object1, object2);
+    s.call(session_exit<name>{});
+    expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s.create<int>(fake_provider<int>{})));
+    s.call(session_entry<name>{});
+    expect_neq(nullptr, static_cast<std::shared_ptr<int>>(s.create<int>(fake_provider<int>{})));
+    s.call(session_exit<name>{});
+    expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s.create<int>(fake_provider<int>{})));
+};
+
+test copy_mt = [] {
+    struct name { };
+    session_mt<name>::scope<int, int> s1;
+    s1.call(session_entry<name>{});
+    std::shared_ptr<int> object1 = s1.create<int>(fake_provider<int>{});
+
+    session_mt<name>::scope<int, int> s2{s1};
+    expect_eq(object1, static_cast<std::shared_ptr<int>>(s2.create<int>(fake_provider<int>{})));
+
+    s1.call(session_exit<name>{});
+    expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s1.create<int>(fake_provider<int>{})));
+    expect_eq(object1, static_cast<std::shared_ptr<int>>(s2.create<int>(fake_provider<int>{})));
+
+    session_mt<name>::scope<int, int> s3{s1};
+    expect_eq(nullptr, static_cast<std::shared_ptr<int>>(s3.create<int>(fake_provider<int>{})));
+};
+
 }}}} // boost::di::v1::scopes
 
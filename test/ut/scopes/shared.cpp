@@ -19,5 +19,24 @@ test create_shared = [] {
     expect_eq(object1, object2);
 };
 
+test create_shared_mt = [] {
+    shared_mt::scope<int, int> shared;
+
+    std::shared_ptr<int> object1 = shared.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2 = shared.create<int>(fake_provider<int>{});
+
+    expect_eq(object1, object2);
+};
+
+test copy_shared_mt = [] {
+    shared_mt::scope<int, int> shared1;
+    std::shared_ptr<int> object1 = shared1.create<int>(fake_provider<int>{});
+
+    shared_mt::scope<int, int> shared2{shared1};
+    std::shared_ptr<int> object2 = shared2.create<int>(fake_provider<int>{});
+
+    expect_eq(object1, object2);
+};
+
 }}}} // boost::di::v1::scopes
 
@@ -19,5 +19,18 @@ test create_singleton = [] {
     expect_eq(object1, object2);
 };
 
+test create_singleton_once = [] {
+    struct c { };
+    singleton::scope<c, c> singleton1;
+    singleton::scope<c, c> singleton2;
+    fake_provider<c>::provide_calls() = 0;
+
+    std::shared_ptr<c> object1 = singleton1.create<c>(fake_provider<c>{});
+    std::shared_ptr<c> object2 = singleton2.create<c>(fake_provider<c>{});
+
+    expect_eq(object1, object2);
+    expect_eq(1, fake_provider<c>::provide_calls());
+};
+
 }}}} // boost::di::v1::scopes
 
@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <thread>
+#include "boost/di/scopes/thread_local_scope.hpp"
+#include "common/fakes/fake_provider.hpp"
+
+namespace boost { namespace di { inline namespace v1 { namespace scopes {
+
+test create_thread_local = [] {
+    thread_local_scope::scope<int, int> thread_local_scope;
+
+    std::shared_ptr<int> object1 = thread_local_scope.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2 = thread_local_scope.create<int>(fake_provider<int>{});
+
+    expect_eq(object1, object2);
+};
+
+test create_thread_local_in_different_threads = [] {
+    thread_local_scope::scope<int, int> thread_local_scope;
+
+    std::shared_ptr<int> object1 = thread_local_scope.create<int>(fake_provider<int>{});
+    std::shared_ptr<int> object2;
+    std::thread{[&] { object2 = thread_local_scope.create<int>(fake_provider<int>{}); }}.join();
+
+    expect(object1);
+    expect(object2);
+    expect_neq(object1, object2);
+};
+
+test thread_local_destroyed_at_thread_exit = [] {
+    struct c { };
+    thread_local_scope::scope<c, c> thread_local_scope;
+    std::weak_ptr<c> object;
+
+    std::thread{[&] {
+        object = static_cast<std::shared_ptr<c>>(thread_local_scope.create<c>(fake_provider<c>{}));
+        expect(!object.expired());
+    }}.join();
+
+    expect(object.expired());
+};
+
+}}}} // boost::di::v1::scopes
+
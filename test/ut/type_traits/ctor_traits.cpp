@@ -88,6 +88,50 @@ test uniforms = [] {
 #endif
 };
 
+test longest_ctor = [] {
+    struct ctors {
+        ctors(int) { }
+        ctors(int, double) { }
+        ctors(int, double, float) { }
+    };
+
+    struct ref_longer {
+        ref_longer(int) { }
+        ref_longer(int&, int&) { }
+    };
+
+    struct fwd_and_ref {
+        fwd_and_ref(int, double) { }
+        fwd_and_ref(int&, double&, float&) { }
+        fwd_and_ref(int, double, float) { }
+    };
+
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_fwd<ctors>, core::any_type_fwd<ctors>, core::any_type_fwd<ctors>>>, ctor_traits<ctors>::type>{});
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_ref_fwd<ref_longer>, core::any_type_ref_fwd<ref_longer>>>, ctor_traits<ref_longer>::type>{});
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_fwd<fwd_and_ref>, core::any_type_fwd<fwd_and_ref>, core::any_type_fwd<fwd_and_ref>>>, ctor_traits<fwd_and_ref>::type>{});
+};
+
+test single_arg_ctors = [] {
+    struct explicit_ctor {
+        explicit explicit_ctor(int) { }
+    };
+
+    struct no_copy {
+        no_copy(int) { }
+        no_copy(no_copy&&) = delete;
+    };
+
+    struct private_dtor {
+        private_dtor(int) { }
+    private:
+        ~private_dtor() { }
+    };
+
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_fwd<explicit_ctor>>>, ctor_traits<explicit_ctor>::type>{});
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_fwd<no_copy>>>, ctor_traits<no_copy>::type>{});
+    expect(std::is_same<aux::pair<direct, aux::type_list<core::any_type_fwd<private_dtor>>>, ctor_traits<private_dtor>::type>{});
+};
+
 test inheriting_ctors = [] {
     struct c0 { c0(int, double) { } };
     struct c1 : public c0 { using c0::c0; };
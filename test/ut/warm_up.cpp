@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include <atomic>
+#include <type_traits>
+#include "boost/di/warm_up.hpp"
+#include "boost/di/scopes/unique.hpp"
+#include "boost/di/core/injector.hpp"
+#include "boost/di/config.hpp"
+
+namespace boost { namespace di { inline namespace v1 {
+
+test warm_up_traits = [] {
+    expect(std::is_same<aux::none_type, core::warm_up_traits<scopes::unique>::type>{});
+    expect(std::is_same<std::false_type, core::warm_up_traits<scopes::shared>::type>{});
+    expect(std::is_same<std::true_type, core::warm_up_traits<scopes::singleton>::type>{});
+};
+
+test warm_up_max = [] {
+    static_assert(0 == core::warm_up_max(), "");
+    static_assert(3 == core::warm_up_max(1, 3, 2), "");
+};
+
+test warm_up_without_bindings = [] {
+    core::injector<di::config> injector{core::init{}};
+    auto calls = 0;
+    injector.warm_up([&](const auto&, const auto&) { ++calls; });
+    expect_eq(0, calls);
+};
+
+test warm_up_workers_run_each_task_once = [] {
+    std::atomic<int> calls[8]{};
+    core::warm_up_workers{4}.run([&](std::size_t i) { ++calls[i]; }, 2, 8);
+    for (auto i = 0; i < 8; ++i) {
+        expect_eq(i < 2 ? 0 : 1, calls[i].load());
+    }
+};
+
+test warm_up_workers_rethrow_on_calling_thread = [] {
+    std::atomic<int> calls{0};
+    auto thrown = 0;
+    try {
+        core::warm_up_workers{4}.run([&](std::size_t i) { ++calls; if (i == 3) { throw 42; } }, 0, 64);
+    } catch (int value) {
+        thrown = value;
+    }
+    expect_eq(42, thrown);
+    expect(calls.load() >= 1);
+};
+
+test warm_up_workers_run_levels_with_the_same_threads = [] {
+    core::warm_up_workers workers{4};
+    std::atomic<int> calls{0};
+    for (auto level = 0; level < 16; ++level) {
+        workers.run([&](std::size_t) { ++calls; }, 0, 8);
+    }
+    expect_eq(16 * 8, calls.load());
+};
+
+}}} // boost::di::v1
@@ -39,5 +39,28 @@ test to_weak_ptr = [] {
     expect(!object.lock());
 };
 
+test to_const_ref_shared_ptr = [] {
+    struct i { virtual ~i() noexcept = default; };
+    struct impl : i { };
+
+    static_assert(shared<impl>::is_referable<const std::shared_ptr<impl>&>::value, "");
+    static_assert(!shared<impl>::is_referable<const std::shared_ptr<i>&>::value, "");
+    static_assert(!shared<impl>::is_referable<std::shared_ptr<impl>>::value, "");
+    static_assert(!shared<impl, false>::is_referable<const std::shared_ptr<impl>&>::value, "");
+    static_assert(!shared<impl>::is_referable<const local_shared_ptr<impl>&>::value, "");
+
+    auto object = std::make_shared<impl>();
+    const std::shared_ptr<impl>& ref = shared<impl>{object};
+    expect_eq(&object, &ref);
+    expect_eq(1, object.use_count());
+};
+
+test to_local_shared_ptr = [] {
+    auto i = std::make_shared<int>(42);
+    auto object = static_cast<local_shared_ptr<int>>(shared<int>{i});
+    expect_eq(i.get(), object.get());
+    expect_eq(1u, object.use_count());
+};
+
 }}}} // boost::di::v1::wrappers
 
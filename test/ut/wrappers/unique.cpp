@@ -5,6 +5,8 @@
 // (See accompanying file LICENSE_1_0.txt or unique at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include <memory>
+#include <new>
+#include <type_traits>
 #include "boost/di/wrappers/unique.hpp"
 #if __has_include(<boost/shared_ptr.hpp>)
     #include <boost/shared_ptr.hpp>
@@ -81,6 +83,26 @@ test to_const_ptr_from_unique_ptr = [] {
     expect_eq(i, *object);
 };
 
+struct destroy_only {
+    template<class T>
+    void operator()(T* object) const noexcept {
+        object->~T();
+    }
+};
+
+test unique_ptr_with_custom_deleter_is_not_released = [] {
+    using custom_t = unique<std::unique_ptr<implementation, destroy_only>>;
+    static_assert(!std::is_convertible<custom_t, interface*>::value, "");
+    static_assert(!std::is_convertible<custom_t, const interface*>::value, "");
+    static_assert(!std::is_convertible<custom_t, std::unique_ptr<interface>>::value, "");
+    static_assert(std::is_convertible<custom_t, std::unique_ptr<interface, destroy_only>>::value, "");
+    static_assert(std::is_convertible<custom_t, std::shared_ptr<interface>>::value, "");
+
+    alignas(implementation) char buffer[sizeof(implementation)];
+    std::unique_ptr<interface, destroy_only> object = custom_t{std::unique_ptr<implementation, destroy_only>{new (buffer) implementation{}}};
+    expect_eq(static_cast<void*>(buffer), static_cast<void*>(object.get()));
+};
+
 test to_copy_from_unique_ptr = [] {
     auto object = static_cast<int>(unique<std::unique_ptr<int>>{std::make_unique<int>(i)});
     expect_eq(i, object);
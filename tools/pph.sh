@@ -29,7 +29,30 @@ main() {
         done
     }
 
+    split_headers() {
+        echo "// config"
+        echo "#include \"boost/di/config.hpp"\"
+        echo
+        echo "// bindings"
+        echo "#include \"boost/di/bindings.hpp"\"
+        echo
+        echo "// injections"
+        echo "#include \"boost/di/inject.hpp\""
+        echo "#include \"boost/di/injector.hpp\""
+        echo "#include \"boost/di/make_injector.hpp\""
+        echo
+        echo "// scopes"
+        echo "#include \"boost/di/scopes/deduce.hpp\""
+        echo "#include \"boost/di/scopes/external.hpp\""
+        echo "#include \"boost/di/scopes/exposed.hpp\""
+        echo "#include \"boost/di/scopes/session.hpp\""
+        echo "#include \"boost/di/scopes/singleton.hpp\""
+        echo "#include \"boost/di/scopes/shared.hpp\""
+        echo "#include \"boost/di/scopes/unique.hpp\""
+    }
+
     tmp_dir=`mktemp -d`
+    split_headers > $tmp_dir/di.hpp
 
     echo "//"
     echo "// Copyright (c) 2012-2015 Krzysztof Jusiak (krzysztof at jusiak dot net)"
@@ -46,29 +69,11 @@ main() {
     echo
     echo "#if defined(BOOST_DI_CFG_NO_PREPROCESSED_HEADERS)"
     echo
-    echo "// config"
-    echo "#include \"boost/di/config.hpp"\"
-    echo
-    echo "// bindings"
-    echo "#include \"boost/di/bindings.hpp"\"
-    echo
-    echo "// injections"
-    echo "#include \"boost/di/inject.hpp\""
-    echo "#include \"boost/di/injector.hpp\""
-    echo "#include \"boost/di/make_injector.hpp\""
-    echo
-    echo "// scopes"
-    echo "#include \"boost/di/scopes/deduce.hpp\""
-    echo "#include \"boost/di/scopes/external.hpp\""
-    echo "#include \"boost/di/scopes/exposed.hpp\""
-    echo "#include \"boost/di/scopes/session.hpp\""
-    echo "#include \"boost/di/scopes/singleton.hpp\""
-    echo "#include \"boost/di/scopes/shared.hpp\""
-    echo "#include \"boost/di/scopes/unique.hpp\""
+    split_headers
     echo
     echo "#else"
     echo
-    generate_pph "boost/di.hpp" "$tmp_dir"
+    generate_pph "$tmp_dir/di.hpp" "$tmp_dir"
     cat $tmp_dir/includes.hpp | sort -u
     cat $tmp_dir/pph.hpp
     echo
@@ -80,5 +85,7 @@ main() {
     rm -rf $tmp_dir
 }
 
-cd "`readlink -f \`dirname $0\``/../include" && main "boost/di.hpp" > "boost/di.hpp"
+# usage: pph.sh [output], `include/boost/di.hpp` by default
+output=`readlink -f "${1:-\`dirname $0\`/../include/boost/di.hpp}"`
+cd "`readlink -f \`dirname $0\``/../include" && main > "$output"
 